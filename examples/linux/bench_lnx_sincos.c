@@ -0,0 +1,93 @@
+//
+// GUIslice Library Examples
+// - Calvin Hass
+// - https://www.impulseadventure.com/elec/guislice-gui.html
+// - https://github.com/ImpulseAdventure/GUIslice
+// - Benchmark: Fixed-point sine / cosine
+//   Compares the lookup table implementation (gslc_SinCosLutFX)
+//   against gslc_SinCosFX() as configured for accuracy and
+//   throughput. With GSLC_USE_FLOAT enabled (the default in the
+//   Linux configuration), gslc_SinCosFX() uses the floating-point
+//   math library. No display is required.
+//
+
+#include "GUIslice.h"
+#include "GUIslice_drv.h"
+
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+
+// Number of passes over the full angle range for the throughput test
+#define BENCH_PASSES  200
+
+// Angles are swept over two full rotations
+#define BENCH_ANG_MIN (-360*64)
+#define BENCH_ANG_MAX (360*64)
+
+typedef void (*tpfSinCos)(int16_t n64Ang,int16_t* pnSin,int16_t* pnCos);
+
+double GetTimeSec()
+{
+  struct timespec sTime;
+  clock_gettime(CLOCK_MONOTONIC,&sTime);
+  return sTime.tv_sec + sTime.tv_nsec*1e-9;
+}
+
+void Bench(const char* pStrName,tpfSinCos pfSinCos)
+{
+  int32_t   n64Ang;
+  int16_t   nSin,nCos;
+  double    fRefSin,fRefCos,fErr;
+  double    fErrMax = 0;
+  double    fErrSq = 0;
+  uint32_t  nCnt = 0;
+
+  // Accuracy relative to the ideal result (scaled by 32767)
+  for (n64Ang=BENCH_ANG_MIN;n64Ang<=BENCH_ANG_MAX;n64Ang++) {
+    (*pfSinCos)((int16_t)n64Ang,&nSin,&nCos);
+    fRefSin = sin(n64Ang*M_PI/(180.0*64.0)) * 32767.0;
+    fRefCos = cos(n64Ang*M_PI/(180.0*64.0)) * 32767.0;
+    fErr = fabs(nSin - fRefSin);
+    fErrMax = (fErr > fErrMax)? fErr : fErrMax;
+    fErrSq += fErr*fErr;
+    fErr = fabs(nCos - fRefCos);
+    fErrMax = (fErr > fErrMax)? fErr : fErrMax;
+    fErrSq += fErr*fErr;
+    nCnt += 2;
+  }
+
+  // Throughput
+  volatile int32_t nSink = 0;
+  uint16_t  nPass;
+  uint32_t  nCalls = 0;
+  double    fTimeStart = GetTimeSec();
+  for (nPass=0;nPass<BENCH_PASSES;nPass++) {
+    for (n64Ang=BENCH_ANG_MIN;n64Ang<=BENCH_ANG_MAX;n64Ang++) {
+      (*pfSinCos)((int16_t)n64Ang,&nSin,&nCos);
+      nSink += nSin + nCos;
+      nCalls++;
+    }
+  }
+  double fTimeElapsed = GetTimeSec() - fTimeStart;
+
+  printf("%-28s  max err %7.2f  rms err %6.2f  %7.2f ns/call  %7.2f Mcalls/s\n",
+    pStrName,fErrMax,sqrt(fErrSq/nCnt),fTimeElapsed*1e9/nCalls,nCalls/fTimeElapsed/1e6);
+}
+
+int main( int argc, char* args[] )
+{
+  printf("GUIslice sine/cosine benchmark\n");
+  printf("- Angles %d..%d (1/64 degree), errors in units of 1/32767\n",BENCH_ANG_MIN,BENCH_ANG_MAX);
+  printf("- GSLC_USE_FLOAT=%d\n\n",GSLC_USE_FLOAT);
+
+  Bench("gslc_SinCosLutFX() (LUT)",&gslc_SinCosLutFX);
+#if (GSLC_USE_FLOAT)
+  Bench("gslc_SinCosFX() (FLOAT)",&gslc_SinCosFX);
+#else
+  Bench("gslc_SinCosFX() (LUT)",&gslc_SinCosFX);
+  printf("\nNOTE: Enable GSLC_USE_FLOAT to compare against the floating-point path\n");
+#endif
+
+  return 0;
+}
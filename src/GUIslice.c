@@ -64,6 +64,7 @@
 #endif
 
 #include <stdarg.h>         // For va_*
+#include <string.h>         // For memcpy(), memmove()
 
 // Version tracking
 #include "GUIslice_version.h"
@@ -167,6 +168,7 @@ bool gslc_Init(gslc_tsGui* pGui,void* pvDriver,gslc_tsPage* asPage,uint8_t nMaxP
 
   pGui->nPageMax        = nMaxPage;
   pGui->nPageCnt        = 0;
+  pGui->nPageIndLookup  = 0;
   pGui->asPage          = asPage;
 
   for (nInd = 0; nInd < GSLC_STACK__MAX; nInd++) {
@@ -177,12 +179,21 @@ bool gslc_Init(gslc_tsGui* pGui,void* pvDriver,gslc_tsPage* asPage,uint8_t nMaxP
   pGui->bRedrawNeeded      = false;
   pGui->bScreenNeedRedraw  = true;
   pGui->bScreenNeedFlip    = false;
+  pGui->bScreenFlipRgnEn   = false;
+  pGui->nFlipRectCnt       = 0;
 
   gslc_InvalidateRgnReset(pGui);
+  pGui->bRedrawClipEn      = false;
+  pGui->nRedrawStackPage   = GSLC_STACK__MAX;
 
-   // Clear the event-pending struct
-  pGui->bEventPending = false;
-  pGui->sEventPend.eType = GSLC_EVT_NONE; 
+  // Clear the deferred event queue
+  pGui->nEventQueueHead = 0;
+  pGui->nEventQueueCnt = 0;
+  memset(&(pGui->sEventQueueStats),0,sizeof(gslc_tsEventQueueStats));
+
+  // Clear the span buffer
+  pGui->nSpanBufCnt = 0;
+  pGui->nSpanBufColRaw = 0;
 
   // Default global element characteristics
   pGui->nRoundRadius = 4;
@@ -207,8 +218,16 @@ bool gslc_Init(gslc_tsGui* pGui,void* pvDriver,gslc_tsPage* asPage,uint8_t nMaxP
     gslc_ResetFont(&(pGui->asFont[nInd]));
   }
 
+  #if (GSLC_STYLE_MAX > 0)
+  // Initialize the shared style table
+  pGui->nStyleCnt   = 0;
+  #endif
+
   // Initialize temporary element
 #if (GSLC_FEATURE_COMPOUND)
+  #if (GSLC_ELEM_COMPACT)
+  pGui->sElemTmp.pAttr = &(pGui->sElemAttrTmp);
+  #endif
   gslc_ResetElem(&(pGui->sElemTmp));
 #endif
 
@@ -255,6 +274,19 @@ bool gslc_Init(gslc_tsGui* pGui,void* pvDriver,gslc_tsPage* asPage,uint8_t nMaxP
   pGui->nFrameRateStart = time(NULL);
   #endif
 
+  // Default to redrawing on every update
+  pGui->nFramePeriod = 0;
+  pGui->nFrameBudget = 0;
+  pGui->nFrameLast = 0;
+  pGui->nFramePendStart = 0;
+  pGui->bFramePend = false;
+  memset(&(pGui->sFrameStats),0,sizeof(gslc_tsFrameStats));
+
+  #if (GSLC_TICK_SUB_MAX > 0)
+  pGui->bTickSubOvf = false;
+  pGui->nTickSubCnt = 0;
+  #endif
+
   // Initialize the display and touch drivers
   if (bOk) {
     bOk &= gslc_DrvInit(pGui);
@@ -598,6 +630,11 @@ void gslc_Quit(gslc_tsGui* pGui)
 // Main polling loop for GUIslice
 void gslc_Update(gslc_tsGui* pGui)
 {
+  // --------------------------------------------------------------
+  // Handle any pending events
+  // --------------------------------------------------------------
+  gslc_EventQueueDrain(pGui,GSLC_EVENT_DRAIN_MAX);
+
   // The touch handling logic is used by both the touchscreen
   // handler as well as the GPIO/pin/keyboard input controller
   #if !defined(DRV_TOUCH_NONE)
@@ -609,14 +646,6 @@ void gslc_Update(gslc_tsGui* pGui)
       GSLC_TXT_DEFAULT, GSLC_COL_RED, GSLC_COL_BLACK);
   }
 
-  // --------------------------------------------------------------
-  // Handle any pending events
-  // --------------------------------------------------------------
-  if (pGui->bEventPending) {
-    gslc_ElemEvent((void*)pGui,pGui->sEventPend);
-    pGui->bEventPending = false;
-  }
-
   // ---------------------------------------------
   // Touch handling
   // ---------------------------------------------
@@ -655,6 +684,17 @@ void gslc_Update(gslc_tsGui* pGui)
   // that we handle in one gslc_Update() call.
   bool      bDoneEvts = false;
   uint16_t  nNumEvts  = 0;
+
+  #if (GSLC_FEATURE_TOUCH_COALESCE)
+  // Touch movement that has been deferred so that it can be
+  // replaced by a later movement sample
+  bool      bTouchPend = false;
+  int16_t   nTouchPendX = 0;
+  int16_t   nTouchPendY = 0;
+  uint16_t  nTouchPendPress = 0;
+  bool      bTouchMove = false;
+  #endif
+
   do {
     bEvent = false;
 
@@ -691,6 +731,17 @@ void gslc_Update(gslc_tsGui* pGui)
     // If event found, handle it
     // --------------------------------------------------------------
     if (bEvent) {
+      #if (GSLC_FEATURE_TOUCH_COALESCE)
+      // A touch sample taken while the touch is held is movement.
+      // Any other event first delivers the deferred movement so
+      // that the ordering of events is preserved.
+      bTouchMove = (eInputEvent == GSLC_INPUT_TOUCH) && (nTouchPress > 0) && (pGui->nTouchLastPress > 0);
+      if ((bTouchPend) && (!bTouchMove)) {
+        gslc_TrackTouch(pGui,NULL,nTouchPendX,nTouchPendY,nTouchPendPress);
+        bTouchPend = false;
+      }
+      #endif
+
       // Track and handle the input events
       // - Handle the events on the current page
       switch (eInputEvent) {
@@ -710,6 +761,17 @@ void gslc_Update(gslc_tsGui* pGui)
           break;
 
         case GSLC_INPUT_TOUCH:
+          #if (GSLC_FEATURE_TOUCH_COALESCE)
+          if (bTouchMove) {
+            // Defer the movement, replacing any earlier deferred movement
+            bTouchPend = true;
+            nTouchPendX = nTouchX;
+            nTouchPendY = nTouchY;
+            nTouchPendPress = nTouchPress;
+            break;
+          }
+          #endif
+
           // Track and handle the touch events
           // - Handle the events on the current page
           gslc_TrackTouch(pGui,NULL,nTouchX,nTouchY,nTouchPress);
@@ -736,25 +798,32 @@ void gslc_Update(gslc_tsGui* pGui)
     }
   } while (!bDoneEvts);
 
+  #if (GSLC_FEATURE_TOUCH_COALESCE)
+  // Deliver the latest movement
+  if (bTouchPend) {
+    gslc_TrackTouch(pGui,NULL,nTouchPendX,nTouchPendY,nTouchPendPress);
+  }
+  #endif
+
   #endif // !DRV_TOUCH_NONE
 
   // ---------------------------------------------
 
-  // Issue a timer tick to all pages
+  // Issue a timer tick to the elements on all pages
   // - This is independent of the pages in the stack
-  uint8_t nPageInd;
-  gslc_tsPage* pPage = NULL;
-  for (nPageInd=0;nPageInd<pGui->nPageCnt;nPageInd++) {
-    pPage = &pGui->asPage[nPageInd];
-    gslc_tsEvent sEvent = gslc_EventCreate(pGui,GSLC_EVT_TICK,0,(void*)pPage,NULL);
-    gslc_PageEvent(pGui,sEvent);
-  }
+  gslc_UpdateTick(pGui);
 
   // Perform any redraw required for current page
   // - Only perform the redraw if at least one element
   //   has been marked as requiring redraw
+  // - If a frame rate has been configured, the redraw is
+  //   deferred until the next frame is due
   if (pGui->bRedrawNeeded) {
-    gslc_PageRedrawGo(pGui);
+    if (pGui->nFramePeriod == 0) {
+      gslc_PageRedrawGo(pGui);
+    } else {
+      gslc_UpdateFrame(pGui);
+    }
   }
 
   // Simple "frame" rate reporting
@@ -778,6 +847,247 @@ void gslc_Update(gslc_tsGui* pGui)
 
 }
 
+// Perform a paced redraw
+// - Called by gslc_Update() when a redraw is pending and
+//   a target frame rate has been configured
+void gslc_UpdateFrame(gslc_tsGui* pGui)
+{
+  gslc_tsFrameStats* pStats = &(pGui->sFrameStats);
+  uint32_t nTimeNow = gslc_DrvGetTimeMs(pGui);
+  uint32_t nTimeRender;
+
+  // Record when the redraw was first requested
+  if (!pGui->bFramePend) {
+    pGui->bFramePend = true;
+    pGui->nFramePendStart = nTimeNow;
+  }
+
+  // Defer the redraw until the next frame is due
+  // - Note that the unsigned difference handles timer wrap
+  if ((uint32_t)(nTimeNow - pGui->nFrameLast) < pGui->nFramePeriod) {
+    pStats->nDeferCnt++;
+    return;
+  }
+
+  // Detect frames that were rendered too late
+  if ((uint32_t)(nTimeNow - pGui->nFramePendStart) > pGui->nFramePeriod) {
+    pStats->nMissCnt++;
+    #ifdef DBG_FRAME_RATE
+    GSLC_DEBUG_PRINT("Frame missed: %u ms late\n",
+      (unsigned)(nTimeNow - pGui->nFramePendStart - pGui->nFramePeriod));
+    #endif
+  }
+
+  gslc_PageRedrawGo(pGui);
+
+  // Measure the render time against the budget
+  nTimeRender = gslc_DrvGetTimeMs(pGui) - nTimeNow;
+  if (nTimeRender > pStats->nRenderTimeMax) {
+    pStats->nRenderTimeMax = (nTimeRender > 0xFFFF)? 0xFFFF : (uint16_t)nTimeRender;
+  }
+  if ((pGui->nFrameBudget > 0) && (nTimeRender > pGui->nFrameBudget)) {
+    pStats->nOverBudgetCnt++;
+  }
+  pStats->nFrameCnt++;
+
+  pGui->nFrameLast = nTimeNow;
+  pGui->bFramePend = false;
+}
+
+void gslc_SetFrameRate(gslc_tsGui* pGui,uint16_t nFps,uint16_t nBudgetMs)
+{
+  if (pGui == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "SetFrameRate";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  pGui->nFramePeriod = (nFps == 0)? 0 : (uint16_t)((1000 + nFps/2) / nFps);
+  pGui->nFrameBudget = nBudgetMs;
+  // Allow the next frame to be drawn immediately
+  pGui->nFrameLast = gslc_DrvGetTimeMs(pGui) - pGui->nFramePeriod;
+  pGui->bFramePend = false;
+}
+
+void gslc_GetFrameStats(gslc_tsGui* pGui,gslc_tsFrameStats* pStats,bool bReset)
+{
+  if ((pGui == NULL) || (pStats == NULL)) {
+    static const char GSLC_PMEM FUNCSTR[] = "GetFrameStats";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  *pStats = pGui->sFrameStats;
+  if (bReset) {
+    memset(&(pGui->sFrameStats),0,sizeof(gslc_tsFrameStats));
+  }
+}
+
+void gslc_GetEventQueueStats(gslc_tsGui* pGui,gslc_tsEventQueueStats* pStats,bool bReset)
+{
+  if ((pGui == NULL) || (pStats == NULL)) {
+    static const char GSLC_PMEM FUNCSTR[] = "GetEventQueueStats";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  *pStats = pGui->sEventQueueStats;
+  if (bReset) {
+    memset(&(pGui->sEventQueueStats),0,sizeof(gslc_tsEventQueueStats));
+  }
+}
+
+// Issue timer ticks
+// - Only the elements in the tick subscription list are visited
+//   unless the list has overflowed
+void gslc_UpdateTick(gslc_tsGui* pGui)
+{
+  #if (GSLC_TICK_SUB_MAX > 0)
+  if (!pGui->bTickSubOvf) {
+    uint8_t         nInd;
+    uint32_t        nTimeNow = 0;
+    bool            bTimeNow = false;
+    gslc_tsTickSub* pTickSub = NULL;
+    for (nInd=0;nInd<pGui->nTickSubCnt;nInd++) {
+      pTickSub = &(pGui->asTickSub[nInd]);
+      if (pTickSub->nPeriod > 0) {
+        // Only fetch the time if a subscription requires it
+        if (!bTimeNow) {
+          nTimeNow = gslc_DrvGetTimeMs(pGui);
+          bTimeNow = true;
+        }
+        if ((uint32_t)(nTimeNow - pTickSub->nTimeLast) < pTickSub->nPeriod) {
+          continue;
+        }
+        // Advance by the period to avoid drift, unless we have
+        // fallen more than a period behind
+        pTickSub->nTimeLast += pTickSub->nPeriod;
+        if ((uint32_t)(nTimeNow - pTickSub->nTimeLast) >= pTickSub->nPeriod) {
+          pTickSub->nTimeLast = nTimeNow;
+        }
+      }
+      gslc_tsEvent sEvent = gslc_EventCreate(pGui,GSLC_EVT_TICK,0,(void*)(pTickSub->pElemRef),NULL);
+      gslc_ElemEvent(pGui,sEvent);
+    }
+    return;
+  }
+  #endif // GSLC_TICK_SUB_MAX
+
+  // Issue the tick to every page
+  uint8_t nPageInd;
+  gslc_tsPage* pPage = NULL;
+  for (nPageInd=0;nPageInd<pGui->nPageCnt;nPageInd++) {
+    pPage = &pGui->asPage[nPageInd];
+    gslc_tsEvent sEvent = gslc_EventCreate(pGui,GSLC_EVT_TICK,0,(void*)pPage,NULL);
+    gslc_PageEvent(pGui,sEvent);
+  }
+}
+
+void gslc_TickSubSet(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,bool bEn,bool bSetPeriod,uint16_t nPeriod)
+{
+#if (GSLC_TICK_SUB_MAX > 0)
+  uint8_t nInd;
+
+  if (pGui->bTickSubOvf) {
+    // All elements are being ticked. Once a callback is removed,
+    // check whether the remaining ones fit in the list again.
+    if (!bEn) {
+      gslc_TickSubRebuild(pGui);
+    }
+    return;
+  }
+  // Only elements on a page receive ticks
+  if (gslc_PageFindByElemRef(pGui,pElemRef) == NULL) {
+    return;
+  }
+
+  for (nInd=0;nInd<pGui->nTickSubCnt;nInd++) {
+    if (pGui->asTickSub[nInd].pElemRef == pElemRef) {
+      break;
+    }
+  }
+
+  if (!bEn) {
+    // Remove any existing subscription
+    if (nInd < pGui->nTickSubCnt) {
+      memmove(&(pGui->asTickSub[nInd]),&(pGui->asTickSub[nInd+1]),
+        (pGui->nTickSubCnt-nInd-1)*sizeof(gslc_tsTickSub));
+      pGui->nTickSubCnt--;
+    }
+    return;
+  }
+
+  if (nInd >= pGui->nTickSubCnt) {
+    if (pGui->nTickSubCnt >= GSLC_TICK_SUB_MAX) {
+      // List is full, so fall back to ticking all elements
+      pGui->bTickSubOvf = true;
+      return;
+    }
+    // Add a new subscription
+    pGui->asTickSub[nInd].pElemRef = pElemRef;
+    pGui->asTickSub[nInd].nPeriod = 0;
+    pGui->asTickSub[nInd].nTimeLast = gslc_DrvGetTimeMs(pGui);
+    pGui->nTickSubCnt++;
+  }
+  if (bSetPeriod) {
+    pGui->asTickSub[nInd].nPeriod = nPeriod;
+  }
+#else
+  (void)pGui; // Unused
+  (void)pElemRef; // Unused
+  (void)bEn; // Unused
+  (void)bSetPeriod; // Unused
+  (void)nPeriod; // Unused
+#endif // GSLC_TICK_SUB_MAX
+}
+
+bool gslc_TickSubRebuild(gslc_tsGui* pGui)
+{
+#if (GSLC_TICK_SUB_MAX > 0)
+  gslc_tsTickSub    asTickSub[GSLC_TICK_SUB_MAX];
+  uint8_t           nTickSubCnt = 0;
+  uint8_t           nPageInd;
+  uint16_t          nElemInd;
+  uint8_t           nInd;
+  uint32_t          nTimeNow = gslc_DrvGetTimeMs(pGui);
+  gslc_tsCollect*   pCollect = NULL;
+  gslc_tsElemRef*   pElemRef = NULL;
+  gslc_tsElem*      pElem = NULL;
+
+  // Collect the elements on all pages that have a tick callback
+  for (nPageInd=0;nPageInd<pGui->nPageCnt;nPageInd++) {
+    pCollect = &(pGui->asPage[nPageInd].sCollect);
+    for (nElemInd=0;nElemInd<pCollect->nElemRefCnt;nElemInd++) {
+      pElemRef = &(pCollect->asElemRef[nElemInd]);
+      pElem = gslc_GetElemFromRef(pGui,pElemRef);
+      if ((pElem == NULL) || (pElem->pfuncXTick == NULL)) {
+        continue;
+      }
+      if (nTickSubCnt >= GSLC_TICK_SUB_MAX) {
+        // Still too many, so continue to tick all elements
+        return false;
+      }
+      // Retain the period of any existing subscription
+      asTickSub[nTickSubCnt].pElemRef = pElemRef;
+      asTickSub[nTickSubCnt].nPeriod = 0;
+      asTickSub[nTickSubCnt].nTimeLast = nTimeNow;
+      for (nInd=0;nInd<pGui->nTickSubCnt;nInd++) {
+        if (pGui->asTickSub[nInd].pElemRef == pElemRef) {
+          asTickSub[nTickSubCnt] = pGui->asTickSub[nInd];
+          break;
+        }
+      }
+      nTickSubCnt++;
+    }
+  }
+
+  memcpy(pGui->asTickSub,asTickSub,nTickSubCnt*sizeof(gslc_tsTickSub));
+  pGui->nTickSubCnt = nTickSubCnt;
+  pGui->bTickSubOvf = false;
+  return true;
+#else
+  (void)pGui; // Unused
+  return false;
+#endif // GSLC_TICK_SUB_MAX
+}
+
 gslc_tsEvent  gslc_EventCreate(gslc_tsGui* pGui,gslc_teEventType eType,uint8_t nSubType,void* pvScope,void* pvData)
 {
   (void)pGui; // Unused
@@ -959,6 +1269,36 @@ bool gslc_ClipRect(gslc_tsRect* pClipRect,gslc_tsRect* pRect)
   return true;
 }
 
+bool gslc_ClipBound(gslc_tsGui* pGui,gslc_tsRect rBound,bool* pbInside)
+{
+#if (GSLC_CLIP_EN)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsRect* pClipRect = &(pDriver->rClipRect);
+  int16_t nCX0 = pClipRect->x;
+  int16_t nCY0 = pClipRect->y;
+  int16_t nCX1 = pClipRect->x + pClipRect->w - 1;
+  int16_t nCY1 = pClipRect->y + pClipRect->h - 1;
+  int16_t nBX0 = rBound.x;
+  int16_t nBY0 = rBound.y;
+  int16_t nBX1 = rBound.x + rBound.w - 1;
+  int16_t nBY1 = rBound.y + rBound.h - 1;
+  *pbInside = false;
+  // Check for completely out of clip view
+  if ( (nBX1 < nCX0) || (nBX0 > nCX1) ) { return false; }
+  if ( (nBY1 < nCY0) || (nBY0 > nCY1) ) { return false; }
+  // Check for completely within clip view
+  if ( (nBX0 >= nCX0) && (nBX1 <= nCX1) && (nBY0 >= nCY0) && (nBY1 <= nCY1) ) {
+    *pbInside = true;
+  }
+  return true;
+#else
+  (void)pGui; // Unused
+  (void)rBound; // Unused
+  *pbInside = true;
+  return true;
+#endif // GSLC_CLIP_EN
+}
+
 
 
 gslc_tsImgRef gslc_ResetImage()
@@ -1027,118 +1367,110 @@ gslc_tsImgRef gslc_GetImageFromProg(const unsigned char* pImgBuf,gslc_teImgRefFl
 }
 
 
-// Sine function with optional lookup table
+// Combined sine and cosine from the lookup table
+// - A single quadrant fold serves both results
+// - The position within the quadrant is scaled to the table with a
+//   multiply and shift, and the result is interpolated linearly
+//   between adjacent table entries
 // - Note that the n64Ang range is limited by 16-bit integers
 //   to an effective degree range of -511 to +511 degrees,
 //   defined by the max integer range: 32767/64.
-int16_t gslc_sinFX(int16_t n64Ang)
-{
-  int16_t   nRetValS;
-
-#if (GSLC_USE_FLOAT)
-  // Use floating-point math library function
-
-  // Calculate angle in radians
-  float fAngRad = n64Ang*GSLC_2PI/(360.0*64.0);
-  // Perform floating point calc
-  float fSin = sin(fAngRad);
-  // Return as fixed point result
-  nRetValS = fSin * 32767.0;
-  return nRetValS;
-
-#else
-  // TODO: Clean up excess integer typecasting
-
-  // Use lookup tables
-  bool bNegate = false;
-
-  // Support multiple waveform periods
-  if (n64Ang >= 360*64) {
-    n64Ang = n64Ang - (360*64);
-  } else if (n64Ang <= -360*64) {
-    n64Ang = n64Ang + (360*64);
-  }
-  // Handle negative range
-  if (n64Ang < 0) {
-    n64Ang = -n64Ang;
-    bNegate = !bNegate;
-  }
-  // Handle 3rd and 4th phase
-  if (n64Ang >= 180*64) {
-    n64Ang -= 180*64;
-    bNegate = !bNegate;
-  }
-  // Handle 2nd phase
-  if (n64Ang >= 90*64) {
-    n64Ang = 180*64 - n64Ang;
-  }
-
-  // n64Ang is quarter-phase range [0 .. 90*64]
-  // suitable for lookup table indexing
 #if defined(LUT_SIN_64)
-  uint16_t  nLutInd = ((uint32_t)n64Ang * 64)/(90*64);
+  #define GSLC_LUT_SIN_SZ     64    // Table intervals per quadrant
+  #define GSLC_LUT_SIN_SCALE  186414UL  // (64<<24)/(90*64)
 #else
-  uint16_t  nLutInd = ((uint32_t)n64Ang * 256)/(90*64);
+  #define GSLC_LUT_SIN_SZ     256   // Table intervals per quadrant
+  #define GSLC_LUT_SIN_SCALE  745654UL  // (256<<24)/(90*64)
 #endif
-  uint16_t  nLutVal = m_nLUTSinF0X16[nLutInd];
 
-  // Leave MSB for the signed bit
-  nLutVal /= 2;
-  if (bNegate) {
-    nRetValS = -nLutVal;
+// Interpolate the table at a quadrant position in 16.16 fixed point
+int16_t gslc_SinLutPos(uint32_t nPos)
+{
+  uint16_t nLutInd  = (uint16_t)(nPos >> 16);
+  uint32_t nLutFrac = nPos & 0xFFFF;
+  uint32_t nLutVal;
+  if (nLutInd >= GSLC_LUT_SIN_SZ) {
+    nLutVal = m_nLUTSinF0X16[GSLC_LUT_SIN_SZ];
   } else {
-    nRetValS = nLutVal;
+    nLutVal = m_nLUTSinF0X16[nLutInd];
+    nLutVal += ((m_nLUTSinF0X16[nLutInd+1] - nLutVal) * nLutFrac) >> 16;
   }
-  return nRetValS;
+  // Leave MSB for the signed bit
+  return (int16_t)(nLutVal >> 1);
+}
 
-#endif
+void gslc_SinCosLutFX(int16_t n64Ang,int16_t* pnSin,int16_t* pnCos)
+{
+  int32_t  n64AngQ = n64Ang;
+  uint8_t  nQuad;
+  int16_t  nValS,nValC;
+
+  // Support multiple waveform periods
+  while (n64AngQ < 0)       { n64AngQ += 360*64; }
+  while (n64AngQ >= 360*64) { n64AngQ -= 360*64; }
+
+  // Fold into the first quadrant
+  nQuad = 0;
+  while (n64AngQ >= 90*64) {
+    n64AngQ -= 90*64;
+    nQuad++;
+  }
+
+  // Position of the angle and its complement within the table
+  // - The scale carries 8 extra fraction bits so that the end of
+  //   the quadrant lands on the last table entry
+  uint32_t nPos = ((uint32_t)n64AngQ * GSLC_LUT_SIN_SCALE + 0x80) >> 8;
+  nValS = gslc_SinLutPos(nPos);
+  nValC = gslc_SinLutPos(((uint32_t)GSLC_LUT_SIN_SZ << 16) - nPos);
 
+  switch (nQuad) {
+    case 0:  *pnSin =  nValS; *pnCos =  nValC; break;
+    case 1:  *pnSin =  nValC; *pnCos = -nValS; break;
+    case 2:  *pnSin = -nValS; *pnCos = -nValC; break;
+    default: *pnSin = -nValC; *pnCos =  nValS; break;
+  }
 }
 
-// Cosine function with optional lookup table
-// - Note that the n64Ang range is limited by 16-bit integers
-//   to an effective degree range of -511 to +511 degrees,
-//   defined by the max integer range: 32767/64.
-int16_t gslc_cosFX(int16_t n64Ang)
+void gslc_SinCosFX(int16_t n64Ang,int16_t* pnSin,int16_t* pnCos)
 {
 #if (GSLC_USE_FLOAT)
-int16_t   nRetValS;
   // Use floating-point math library function
 
   // Calculate angle in radians
-  float fAngRad = n64Ang * GSLC_2PI / (360.0*64.0);
-  // Perform floating point calc
-  float fCos = cos(fAngRad);
-  // Return as fixed point result
-  nRetValS = fCos * 32767.0;
-  return nRetValS;
-
+  float fAngRad = n64Ang*GSLC_2PI/(360.0*64.0);
+  // Perform floating point calc and return as fixed point result
+  *pnSin = sin(fAngRad) * 32767.0;
+  *pnCos = cos(fAngRad) * 32767.0;
 #else
   // Use lookup tables
-  // Cosine function is equivalent to Sine shifted by 90 degrees
-  // - To avoid int16_t overflow, we trap range beyond 360 degrees
-  //   and shift the angle by one rotation (360 degrees).
-  // - This is necessary because otherwise the +90*64 would reduce the
-  //   effective range of cosFX() to +421 degrees.
-  if (n64Ang >= 360 * 64) {
-    return gslc_sinFX((n64Ang - 360*64) + 90*64);
-  } else {
-    return gslc_sinFX(n64Ang+90*64);
-  }
-
+  gslc_SinCosLutFX(n64Ang,pnSin,pnCos);
 #endif
+}
+
+// Sine function with optional lookup table
+int16_t gslc_sinFX(int16_t n64Ang)
+{
+  int16_t nSin,nCos;
+  gslc_SinCosFX(n64Ang,&nSin,&nCos);
+  return nSin;
+}
 
+// Cosine function with optional lookup table
+int16_t gslc_cosFX(int16_t n64Ang)
+{
+  int16_t nSin,nCos;
+  gslc_SinCosFX(n64Ang,&nSin,&nCos);
+  return nCos;
 }
 
 // Convert from polar to cartesian
 void gslc_PolarToXY(uint16_t nRad,int16_t n64Ang,int16_t* nDX,int16_t* nDY)
 {
-  int32_t nTmp;
-  // TODO: Clean up excess integer typecasting
-  nTmp = (int32_t)nRad *  gslc_sinFX(n64Ang);
-  *nDX = nTmp / 32767;
-  nTmp = (int32_t)nRad * -gslc_cosFX(n64Ang);
-  *nDY = nTmp / 32767;
+  int16_t nSin,nCos;
+  gslc_SinCosFX(n64Ang,&nSin,&nCos);
+  // Scale by the radius, rounding to the nearest pixel
+  *nDX = (int16_t)(((int32_t)nRad *  nSin + 0x4000) >> 15);
+  *nDY = (int16_t)(((int32_t)nRad * -nCos + 0x4000) >> 15);
 }
 
 // Call with nMidAmt=500 to create simple linear blend between two colors
@@ -1179,16 +1511,30 @@ bool gslc_ColorEqual(gslc_tsColor a,gslc_tsColor b)
   return a.r == b.r && a.g == b.g && a.b == b.b;
 }
 
+gslc_tsColorRaw gslc_ColorToRaw(gslc_tsGui* pGui,gslc_tsColor nCol)
+{
+  return gslc_DrvColorToRaw(pGui,nCol);
+}
+
 // ------------------------------------------------------------------------
 // Graphics Primitive Functions
 // ------------------------------------------------------------------------
 
 void gslc_DrawSetPixel(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol)
 {
+  gslc_DrawSetPixelRaw(pGui,nX,nY,gslc_DrvColorToRaw(pGui,nCol));
+}
+
+void gslc_DrawSetPixelRaw(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColorRaw nColRaw)
+{
+#if (GSLC_CLIP_EN)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (!gslc_ClipPt(&(pDriver->rClipRect),nX,nY)) { return; }
+#endif
 
 #if (DRV_HAS_DRAW_POINT)
   // Call optimized driver point drawing
-  gslc_DrvDrawPoint(pGui,nX,nY,nCol);
+  gslc_DrvDrawPointRaw(pGui,nX,nY,nColRaw);
 #else
   GSLC_DEBUG2_PRINT("ERROR: Mandatory DrvDrawPoint() is not defined in driver\n");
 #endif
@@ -1196,17 +1542,127 @@ void gslc_DrawSetPixel(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol)
   gslc_PageFlipSet(pGui,true);
 }
 
+void gslc_DrawPoints(gslc_tsGui* pGui,gslc_tsPt* asPt,uint16_t nNumPt,gslc_tsColor nCol)
+{
+  gslc_DrawPointsRaw(pGui,asPt,nNumPt,gslc_DrvColorToRaw(pGui,nCol));
+}
+
+void gslc_DrawPointsRaw(gslc_tsGui* pGui,gslc_tsPt* asPt,uint16_t nNumPt,gslc_tsColorRaw nColRaw)
+{
+  gslc_tsPtRun  sRun;
+  uint16_t      nPtInd;
+  gslc_DrawPtRunInit(&sRun);
+  for (nPtInd=0;nPtInd<nNumPt;nPtInd++) {
+    gslc_DrawPtRunAdd(pGui,&sRun,asPt[nPtInd].x,asPt[nPtInd].y,nColRaw);
+  }
+  gslc_DrawPtRunFlush(pGui,&sRun,nColRaw);
+  gslc_DrawSpanFlush(pGui);
+
+  gslc_PageFlipSet(pGui,true);
+}
+
+void gslc_DrawPtRunInit(gslc_tsPtRun* pRun)
+{
+  pRun->nX   = 0;
+  pRun->nY   = 0;
+  pRun->nLen = 0;
+  pRun->nDX  = 0;
+  pRun->nDY  = 0;
+}
+
+void gslc_DrawPtRunAdd(gslc_tsGui* pGui,gslc_tsPtRun* pRun,int16_t nX,int16_t nY,gslc_tsColorRaw nColRaw)
+{
+  int16_t nDX,nDY;
+  if (pRun->nLen == 1) {
+    // The second point sets the direction of the run
+    nDX = nX - pRun->nX;
+    nDY = nY - pRun->nY;
+    if ((nDX == 0) && (nDY == 0)) {
+      return;
+    }
+    if ( ((nDY == 0) && ((nDX == 1) || (nDX == -1))) ||
+         ((nDX == 0) && ((nDY == 1) || (nDY == -1))) ) {
+      pRun->nDX  = (int8_t)nDX;
+      pRun->nDY  = (int8_t)nDY;
+      pRun->nLen = 2;
+      return;
+    }
+  } else if (pRun->nLen > 1) {
+    // Offset from the last point in the run
+    nDX = nX - (pRun->nX + pRun->nDX * (int16_t)(pRun->nLen-1));
+    nDY = nY - (pRun->nY + pRun->nDY * (int16_t)(pRun->nLen-1));
+    if ((nDX == 0) && (nDY == 0)) {
+      return;
+    }
+    if ((nDX == pRun->nDX) && (nDY == pRun->nDY)) {
+      pRun->nLen++;
+      return;
+    }
+  }
+
+  // Point doesn't continue the run, so start a new one
+  gslc_DrawPtRunFlush(pGui,pRun,nColRaw);
+  pRun->nX   = nX;
+  pRun->nY   = nY;
+  pRun->nLen = 1;
+}
+
+void gslc_DrawPtRunFlush(gslc_tsGui* pGui,gslc_tsPtRun* pRun,gslc_tsColorRaw nColRaw)
+{
+  int16_t nX0,nY0;
+  if (pRun->nLen == 1) {
+    gslc_DrawSetPixelRaw(pGui,pRun->nX,pRun->nY,nColRaw);
+  } else if (pRun->nLen > 1) {
+    // Start from the top-left end of the run
+    nX0 = pRun->nX;
+    nY0 = pRun->nY;
+    if (pRun->nDX < 0) { nX0 -= pRun->nLen-1; }
+    if (pRun->nDY < 0) { nY0 -= pRun->nLen-1; }
+    if (pRun->nDY == 0) {
+      gslc_DrawSpanAdd(pGui,nX0,nY0,pRun->nLen,nColRaw);
+    } else {
+      gslc_DrawFillRectRaw(pGui,(gslc_tsRect){nX0,nY0,1,pRun->nLen},nColRaw);
+    }
+  }
+  pRun->nLen = 0;
+}
+
 // Draw an arbitrary line using Bresenham's algorithm
 // - Algorithm reference: https://rosettacode.org/wiki/Bitmap/Bresenham's_line_algorithm#C
 void gslc_DrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColor nCol)
 {
+  gslc_DrawLineRaw(pGui,nX0,nY0,nX1,nY1,gslc_DrvColorToRaw(pGui,nCol));
+}
+
+void gslc_DrawLineRaw(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColorRaw nColRaw)
+{
+  // Check the bounding rect of the line against the clipping region
+  // - A partially clipped line is still stepped from its original
+  //   endpoints so that the visible pixels match the unclipped line.
+  //   The runs that it is drawn with are clipped individually.
+  gslc_tsRect rBound;
+  rBound.x = (nX0 < nX1)? nX0 : nX1;
+  rBound.y = (nY0 < nY1)? nY0 : nY1;
+  rBound.w = abs(nX1-nX0) + 1;
+  rBound.h = abs(nY1-nY0) + 1;
+  bool bInside;
+  if (!gslc_ClipBound(pGui,rBound,&bInside)) {
+    return;
+  }
 
 #if (DRV_HAS_DRAW_LINE)
-  // Call optimized driver line drawing
-  gslc_DrvDrawLine(pGui,nX0,nY0,nX1,nY1,nCol);
+  if (bInside) {
+    // Call optimized driver line drawing
+    gslc_DrvDrawLineRaw(pGui,nX0,nY0,nX1,nY1,nColRaw);
+    gslc_PageFlipSet(pGui,true);
+    return;
+  }
+#endif
 
-#else
   // Perform Bresenham's line algorithm
+  // - Pixels are emitted as run slices: consecutive pixels that share
+  //   a row (shallow line) or a column (steep line) are drawn as a
+  //   single span or fill rather than with a call per pixel
   int16_t nDX = abs(nX1-nX0);
   int16_t nDY = abs(nY1-nY0);
 
@@ -1222,58 +1678,111 @@ void gslc_DrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t
     if (nDY == 0) {
       return;
     } else if (nY1-nY0 >= 0) {
-      gslc_DrawLineV(pGui,nX0,nY0,nDY+1,nCol);
+      gslc_DrawLineVRaw(pGui,nX0,nY0,nDY+1,nColRaw);
       bDone = true;
     } else {
-      gslc_DrawLineV(pGui,nX1,nY1,nDY+1,nCol);
+      gslc_DrawLineVRaw(pGui,nX1,nY1,nDY+1,nColRaw);
       bDone = true;
     }
   } else if (nDY == 0) {
     if (nX1-nX0 >= 0) {
-      gslc_DrawLineH(pGui,nX0,nY0,nDX+1,nCol);
+      gslc_DrawLineHRaw(pGui,nX0,nY0,nDX+1,nColRaw);
       bDone = true;
     } else {
-      gslc_DrawLineH(pGui,nX1,nY1,nDX+1,nCol);
+      gslc_DrawLineHRaw(pGui,nX1,nY1,nDX+1,nColRaw);
       bDone = true;
     }
   }
 
   if (!bDone) {
+    bool bHoriz = (nDX >= nDY);
+    gslc_tsPtRun sRun;
+    sRun.nX   = nX0;
+    sRun.nY   = nY0;
+    sRun.nLen = 1;
+    sRun.nDX  = (bHoriz)? nSX : 0;
+    sRun.nDY  = (bHoriz)? 0 : nSY;
     for (;;) {
-      // Set the pixel
-      gslc_DrvDrawPoint(pGui,nX0,nY0,nCol);
-
       // Calculate next coordinates
       if ( (nX0 == nX1) && (nY0 == nY1) ) break;
       nE2 = nErr;
       if (nE2 > -nDX) { nErr -= nDY; nX0 += nSX; }
       if (nE2 <  nDY) { nErr += nDX; nY0 += nSY; }
+
+      // Extend the run until the minor axis steps
+      if ((bHoriz)? (nY0 == sRun.nY) : (nX0 == sRun.nX)) {
+        sRun.nLen++;
+      } else {
+        gslc_DrawPtRunFlush(pGui,&sRun,nColRaw);
+        sRun.nX   = nX0;
+        sRun.nY   = nY0;
+        sRun.nLen = 1;
+      }
     }
+    gslc_DrawPtRunFlush(pGui,&sRun,nColRaw);
+    gslc_DrawSpanFlush(pGui);
   }
   gslc_PageFlipSet(pGui,true);
-#endif
 
 }
 
 
 void gslc_DrawLineH(gslc_tsGui* pGui,int16_t nX, int16_t nY, uint16_t nW,gslc_tsColor nCol)
 {
-  uint16_t nOffset;
-  for (nOffset=0;nOffset<nW;nOffset++) {
-    gslc_DrvDrawPoint(pGui,nX+nOffset,nY,nCol);
-  }
+  gslc_DrawLineHRaw(pGui,nX,nY,nW,gslc_DrvColorToRaw(pGui,nCol));
+}
+
+void gslc_DrawLineHRaw(gslc_tsGui* pGui,int16_t nX, int16_t nY, uint16_t nW,gslc_tsColorRaw nColRaw)
+{
+#if (DRV_HAS_DRAW_RECT_FILL)
+  // Draw as a rect one pixel high
+  gslc_DrawFillRectRaw(pGui,(gslc_tsRect){nX,nY,nW,1},nColRaw);
+#else
+#if (GSLC_CLIP_EN)
+  // Trim the line to the clipping region
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsRect rLine = (gslc_tsRect){nX,nY,nW,1};
+  if (!gslc_ClipRect(&(pDriver->rClipRect),&rLine)) { return; }
+  nX = rLine.x;
+  nW = rLine.w;
+#endif
+
+  uint16_t nOffset;
+  for (nOffset=0;nOffset<nW;nOffset++) {
+    gslc_DrvDrawPointRaw(pGui,nX+nOffset,nY,nColRaw);
+  }
 
   gslc_PageFlipSet(pGui,true);
+#endif // DRV_HAS_DRAW_RECT_FILL
 }
 
 void gslc_DrawLineV(gslc_tsGui* pGui,int16_t nX, int16_t nY, uint16_t nH,gslc_tsColor nCol)
 {
+  gslc_DrawLineVRaw(pGui,nX,nY,nH,gslc_DrvColorToRaw(pGui,nCol));
+}
+
+void gslc_DrawLineVRaw(gslc_tsGui* pGui,int16_t nX, int16_t nY, uint16_t nH,gslc_tsColorRaw nColRaw)
+{
+#if (DRV_HAS_DRAW_RECT_FILL)
+  // Draw as a rect one pixel wide
+  gslc_DrawFillRectRaw(pGui,(gslc_tsRect){nX,nY,1,nH},nColRaw);
+#else
+#if (GSLC_CLIP_EN)
+  // Trim the line to the clipping region
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsRect rLine = (gslc_tsRect){nX,nY,1,nH};
+  if (!gslc_ClipRect(&(pDriver->rClipRect),&rLine)) { return; }
+  nY = rLine.y;
+  nH = rLine.h;
+#endif
+
   uint16_t nOffset;
   for (nOffset=0;nOffset<nH;nOffset++) {
-    gslc_DrvDrawPoint(pGui,nX,nY+nOffset,nCol);
+    gslc_DrvDrawPointRaw(pGui,nX,nY+nOffset,nColRaw);
   }
 
   gslc_PageFlipSet(pGui,true);
+#endif // DRV_HAS_DRAW_RECT_FILL
 }
 
 
@@ -1281,10 +1790,13 @@ void gslc_DrawLineV(gslc_tsGui* pGui,int16_t nX, int16_t nY, uint16_t nH,gslc_ts
 void gslc_DrawLinePolar(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nRadStart,uint16_t nRadEnd,int16_t n64Ang,gslc_tsColor nCol)
 {
   // Draw the ray representing the current value
-  int16_t nDxS = (int32_t)nRadStart * gslc_sinFX(n64Ang)/32768;
-  int16_t nDyS = (int32_t)nRadStart * gslc_cosFX(n64Ang)/32768;
-  int16_t nDxE = (int32_t)nRadEnd   * gslc_sinFX(n64Ang)/32768;
-  int16_t nDyE = (int32_t)nRadEnd   * gslc_cosFX(n64Ang)/32768;
+  int16_t nSin,nCos;
+  gslc_SinCosFX(n64Ang,&nSin,&nCos);
+  // Scale by the radius, rounding to the nearest pixel
+  int16_t nDxS = (int16_t)(((int32_t)nRadStart * nSin + 0x4000) >> 15);
+  int16_t nDyS = (int16_t)(((int32_t)nRadStart * nCos + 0x4000) >> 15);
+  int16_t nDxE = (int16_t)(((int32_t)nRadEnd   * nSin + 0x4000) >> 15);
+  int16_t nDyE = (int16_t)(((int32_t)nRadEnd   * nCos + 0x4000) >> 15);
   gslc_DrawLine(pGui,nX+nDxS,nY-nDyS,nX+nDxE,nY-nDyE,nCol);
 }
 
@@ -1295,23 +1807,47 @@ void gslc_DrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
   if ((rRect.w == 0) || (rRect.h == 0)) {
     return;
   }
+  gslc_DrawFrameRectRaw(pGui,rRect,gslc_DrvColorToRaw(pGui,nCol));
+}
+
+void gslc_DrawFrameRectRaw(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColorRaw nColRaw)
+{
+  // Ensure dimensions are valid
+  if ((rRect.w == 0) || (rRect.h == 0)) {
+    return;
+  }
+
+  bool bInside;
+  if (!gslc_ClipBound(pGui,rRect,&bInside)) {
+    return;
+  }
 
 #if (DRV_HAS_DRAW_RECT_FRAME)
-  // Call optimized driver implementation
-  gslc_DrvDrawFrameRect(pGui,rRect,nCol);
-#else
-  // Emulate rect frame with four lines
+  if (bInside) {
+    // Call optimized driver implementation
+    gslc_DrvDrawFrameRectRaw(pGui,rRect,nColRaw);
+    gslc_PageFlipSet(pGui,true);
+    return;
+  }
+#endif
+
+  // Emulate rect frame with four edge fills, each clipped to the region
   int16_t   nX,nY;
   uint16_t  nH,nW;
   nX = rRect.x;
   nY = rRect.y;
   nW = rRect.w;
   nH = rRect.h;
-  gslc_DrawLineH(pGui,nX,nY,nW-1,nCol);                 // Top
-  gslc_DrawLineH(pGui,nX,(int16_t)(nY+nH-1),nW-1,nCol); // Bottom
-  gslc_DrawLineV(pGui,nX,nY,nH-1,nCol);                 // Left
-  gslc_DrawLineV(pGui,(int16_t)(nX+nW-1),nY,nH-1,nCol); // Right
-#endif
+  gslc_DrawFillRectRaw(pGui,(gslc_tsRect){nX,nY,nW,1},nColRaw);                          // Top
+  if (nH > 1) {
+    gslc_DrawFillRectRaw(pGui,(gslc_tsRect){nX,(int16_t)(nY+nH-1),nW,1},nColRaw);        // Bottom
+  }
+  if (nH > 2) {
+    gslc_DrawFillRectRaw(pGui,(gslc_tsRect){nX,(int16_t)(nY+1),1,(uint16_t)(nH-2)},nColRaw); // Left
+    if (nW > 1) {
+      gslc_DrawFillRectRaw(pGui,(gslc_tsRect){(int16_t)(nX+nW-1),(int16_t)(nY+1),1,(uint16_t)(nH-2)},nColRaw); // Right
+    }
+  }
 
   gslc_PageFlipSet(pGui,true);
 }
@@ -1323,34 +1859,133 @@ void gslc_DrawFrameRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadius,
     return;
   }
 
+  bool bInside;
+  if (!gslc_ClipBound(pGui,rRect,&bInside)) {
+    return;
+  }
+
 #if (DRV_HAS_DRAW_RECT_ROUND_FRAME)
-  // Call optimized driver implementation
-  gslc_DrvDrawFrameRoundRect(pGui,rRect,nRadius,nCol);
-#else
-  // TODO: Add emulation of rounded rects. For now fallback to square corners
-  gslc_DrvDrawFrameRect(pGui,rRect,nCol);
+  if (bInside) {
+    // Call optimized driver implementation
+    gslc_DrvDrawFrameRoundRect(pGui,rRect,nRadius,nCol);
+    gslc_PageFlipSet(pGui,true);
+    return;
+  }
 #endif
 
+  // Emulate rounded rect with edges and corner points that are clipped
+  gslc_DrawFrameRoundRectArcs(pGui,rRect,nRadius,gslc_DrvColorToRaw(pGui,nCol));
+
   gslc_PageFlipSet(pGui,true);
 }
 
+void gslc_DrawFrameRoundRectArcs(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadius,gslc_tsColorRaw nColRaw)
+{
+  int16_t nRadMax = ((rRect.w < rRect.h)? rRect.w : rRect.h) / 2;
+  nRadius = (nRadius < 0)? 0 : nRadius;
+  nRadius = (nRadius > nRadMax)? nRadMax : nRadius;
+  if (nRadius == 0) {
+    // Without corners the edges would overlap at the ends
+    gslc_DrawFrameRectRaw(pGui,rRect,nColRaw);
+    return;
+  }
+
+  // Corner centers
+  int16_t nCX0 = rRect.x + nRadius;
+  int16_t nCY0 = rRect.y + nRadius;
+  int16_t nCX1 = rRect.x + rRect.w - 1 - nRadius;
+  int16_t nCY1 = rRect.y + rRect.h - 1 - nRadius;
+  uint16_t nEdgeW = nCX1 - nCX0 + 1;
+  uint16_t nEdgeH = nCY1 - nCY0 + 1;
+
+  // Straight edges between the corners
+  gslc_DrawFillRectRaw(pGui,(gslc_tsRect){nCX0,rRect.y,nEdgeW,1},nColRaw);                            // Top
+  gslc_DrawFillRectRaw(pGui,(gslc_tsRect){nCX0,(int16_t)(rRect.y+rRect.h-1),nEdgeW,1},nColRaw);      // Bottom
+  gslc_DrawFillRectRaw(pGui,(gslc_tsRect){rRect.x,nCY0,1,nEdgeH},nColRaw);                            // Left
+  gslc_DrawFillRectRaw(pGui,(gslc_tsRect){(int16_t)(rRect.x+rRect.w-1),nCY0,1,nEdgeH},nColRaw);      // Right
+
+  // Corners with midpoint circle algorithm
+  // - Each octant is collected into runs of adjacent points
+  // - Every pixel is drawn once. The point on the diagonal (a=b)
+  //   is shared by the two octants of a corner. The points on the
+  //   axes (b=0) are the ends of the straight edges, or where the
+  //   corners meet without an edge between them, they coincide with
+  //   the adjacent corner's point at b=1 unless the arc steps inward
+  //   there (as given by the first pass of the loop below).
+  bool bAxisPt = (2*(3-nRadius) + 1 > 0);
+  bool bAxisPtH = (nEdgeH == 0) && bAxisPt;
+  bool bAxisPtV = (nEdgeW == 0) && bAxisPt;
+  gslc_tsPtRun  asRun[8];
+  uint8_t       nRunInd;
+  for (nRunInd=0;nRunInd<8;nRunInd++) {
+    gslc_DrawPtRunInit(&asRun[nRunInd]);
+  }
+  int16_t nX    = nRadius;
+  int16_t nY    = 0;
+  int16_t nErr  = 0;
+  while (nX >= nY)
+  {
+    if ((nY > 0) || bAxisPtH) {
+      gslc_DrawPtRunAdd(pGui,&asRun[0],nCX1 + nX, nCY1 + nY,nColRaw);
+      gslc_DrawPtRunAdd(pGui,&asRun[3],nCX0 - nX, nCY1 + nY,nColRaw);
+      gslc_DrawPtRunAdd(pGui,&asRun[4],nCX0 - nX, nCY0 - nY,nColRaw);
+      gslc_DrawPtRunAdd(pGui,&asRun[7],nCX1 + nX, nCY0 - nY,nColRaw);
+    }
+    if ((nX != nY) && ((nY > 0) || bAxisPtV)) {
+      gslc_DrawPtRunAdd(pGui,&asRun[1],nCX1 + nY, nCY1 + nX,nColRaw);
+      gslc_DrawPtRunAdd(pGui,&asRun[2],nCX0 - nY, nCY1 + nX,nColRaw);
+      gslc_DrawPtRunAdd(pGui,&asRun[5],nCX0 - nY, nCY0 - nX,nColRaw);
+      gslc_DrawPtRunAdd(pGui,&asRun[6],nCX1 + nY, nCY0 - nX,nColRaw);
+    }
+
+    nY    += 1;
+    nErr  += 1 + 2*nY;
+    if (2*(nErr-nX) + 1 > 0)
+    {
+        nX -= 1;
+        nErr += 1 - 2*nX;
+    }
+  } // while
+  for (nRunInd=0;nRunInd<8;nRunInd++) {
+    gslc_DrawPtRunFlush(pGui,&asRun[nRunInd],nColRaw);
+  }
+  gslc_DrawSpanFlush(pGui);
+}
+
 
 void gslc_DrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
+{
+  // Ensure dimensions are valid
+  if ((rRect.w == 0) || (rRect.h == 0)) {
+    return;
+  }
+  gslc_DrawFillRectRaw(pGui,rRect,gslc_DrvColorToRaw(pGui,nCol));
+}
+
+void gslc_DrawFillRectRaw(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColorRaw nColRaw)
 {
   // Ensure dimensions are valid
   if ((rRect.w == 0) || (rRect.h == 0)) {
     return;
   }
 
+#if (GSLC_CLIP_EN)
+  // Trim the rect to the clipping region
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (!gslc_ClipRect(&(pDriver->rClipRect),&rRect)) {
+    return;
+  }
+#endif
+
 #if (DRV_HAS_DRAW_RECT_FILL)
   // Call optimized driver implementation
-  gslc_DrvDrawFillRect(pGui,rRect,nCol);
+  gslc_DrvDrawFillRectRaw(pGui,rRect,nColRaw);
 #else
   // Emulate it with individual line draws
   // TODO: This should be avoided as it will generally be very inefficient
   int nRow;
   for (nRow=0;nRow<rRect.h;nRow++) {
-    gslc_DrawLineH(pGui, rRect.x, rRect.y+nRow, rRect.w, nCol);
+    gslc_DrawLineHRaw(pGui, rRect.x, rRect.y+nRow, rRect.w, nColRaw);
   }
 
 #endif
@@ -1358,6 +1993,53 @@ void gslc_DrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
   gslc_PageFlipSet(pGui,true);
 }
 
+bool gslc_DrawCopyRect(gslc_tsGui* pGui,gslc_tsRect rSrc,int16_t nDstX,int16_t nDstY)
+{
+  // Nothing to copy
+  if ((rSrc.w == 0) || (rSrc.h == 0)) {
+    return true;
+  }
+
+#if (DRV_HAS_COPY_RECT)
+  gslc_tsRect rDst = (gslc_tsRect){nDstX,nDstY,rSrc.w,rSrc.h};
+  gslc_tsRect rClip = gslc_GetClipRect(pGui);
+
+  // Only copy pixels that belong to the region being drawn. Clipping
+  // the copy would leave part of the destination stale, so defer to
+  // a redraw instead.
+  if (!gslc_IsInRect(rSrc.x,rSrc.y,rClip) || !gslc_IsInRect(rSrc.x+rSrc.w-1,rSrc.y+rSrc.h-1,rClip) ||
+      !gslc_IsInRect(rDst.x,rDst.y,rClip) || !gslc_IsInRect(rDst.x+rDst.w-1,rDst.y+rDst.h-1,rClip)) {
+    return false;
+  }
+
+  // Pages higher in the stack may have been drawn over the region
+  // (eg. a popup), in which case the display no longer holds the
+  // element's pixels
+  if (pGui->nRedrawStackPage < GSLC_STACK__MAX) {
+    int nStackPage;
+    gslc_tsPage* pPage;
+    gslc_UnionRect(&rDst,rSrc);
+    for (nStackPage=pGui->nRedrawStackPage+1;nStackPage<GSLC_STACK__MAX;nStackPage++) {
+      pPage = pGui->apPageStack[nStackPage];
+      if ((pPage) && (gslc_IsRectOverlap(pPage->rBounds,rDst))) {
+        return false;
+      }
+    }
+  }
+
+  if (!gslc_DrvCopyRect(pGui,rSrc,nDstX,nDstY)) {
+    return false;
+  }
+  gslc_PageFlipSet(pGui,true);
+  return true;
+#else
+  (void)pGui; // Unused
+  (void)nDstX; // Unused
+  (void)nDstY; // Unused
+  return false;
+#endif // DRV_HAS_COPY_RECT
+}
+
 void gslc_DrawFillRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadius,gslc_tsColor nCol)
 {
   // Ensure dimensions are valid
@@ -1365,17 +2047,79 @@ void gslc_DrawFillRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadius,g
     return;
   }
 
+  bool bInside;
+  if (!gslc_ClipBound(pGui,rRect,&bInside)) {
+    return;
+  }
+
 #if (DRV_HAS_DRAW_RECT_ROUND_FILL)
-  // Call optimized driver implementation
-  gslc_DrvDrawFillRoundRect(pGui,rRect,nRadius,nCol);
-#else
-  // TODO: Add emulation of rounded rects. For now fallback to square corners
-  gslc_DrvDrawFillRect(pGui,rRect,nCol);
+  if (bInside) {
+    // Call optimized driver implementation
+    gslc_DrvDrawFillRoundRect(pGui,rRect,nRadius,nCol);
+    gslc_PageFlipSet(pGui,true);
+    return;
+  }
 #endif
 
+  // Emulate rounded rect with spans, which are clipped as they are flushed
+  gslc_DrawFillRoundRectSpans(pGui,rRect,nRadius,gslc_DrvColorToRaw(pGui,nCol));
+  gslc_DrawSpanFlush(pGui);
+
   gslc_PageFlipSet(pGui,true);
 }
 
+void gslc_DrawFillRoundRectSpans(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadius,gslc_tsColorRaw nColRaw)
+{
+  int16_t nRadMax = ((rRect.w < rRect.h)? rRect.w : rRect.h) / 2;
+  nRadius = (nRadius < 0)? 0 : nRadius;
+  nRadius = (nRadius > nRadMax)? nRadMax : nRadius;
+
+  // Corner centers
+  int16_t nCX0 = rRect.x + nRadius;
+  int16_t nCY0 = rRect.y + nRadius;
+  int16_t nCY1 = rRect.y + rRect.h - 1 - nRadius;
+  uint16_t nMidW = rRect.w - 2*nRadius;
+
+  // The band between the corner centers spans the full width
+  gslc_DrawFillRectRaw(pGui,(gslc_tsRect){rRect.x,nCY0,rRect.w,(uint16_t)(nCY1-nCY0+1)},nColRaw);
+
+  // Corner rows with midpoint circle algorithm
+  // - Each row is emitted once, at its widest extent
+  int16_t nX    = nRadius;  // a
+  int16_t nY    = 0;        // b
+  int16_t nErr  = 0;
+  int16_t nYPrev;
+  bool    bStepX;
+
+  while (nX >= nY)
+  {
+    // Rows at (+/-b) span (-a..+a). Row 0 is part of the band.
+    if (nY != 0) {
+      gslc_DrawSpanAdd(pGui,nCX0-nX,nCY1+nY,nMidW+2*nX,nColRaw);
+      gslc_DrawSpanAdd(pGui,nCX0-nX,nCY0-nY,nMidW+2*nX,nColRaw);
+    }
+
+    nYPrev = nY;
+    nY    += 1;
+    nErr  += 1 + 2*nY;
+    bStepX = (2*(nErr-nX) + 1 > 0);
+
+    // Rows at (+/-a) span (-b..+b) and are widest just before a
+    // changes or the octant ends. When a==b the row was already
+    // emitted above.
+    if ((bStepX || (nX < nY)) && (nX != nYPrev)) {
+      gslc_DrawSpanAdd(pGui,nCX0-nYPrev,nCY1+nX,nMidW+2*nYPrev,nColRaw);
+      gslc_DrawSpanAdd(pGui,nCX0-nYPrev,nCY0-nX,nMidW+2*nYPrev,nColRaw);
+    }
+
+    if (bStepX)
+    {
+        nX -= 1;
+        nErr += 1 - 2*nX;
+    }
+  } // while
+}
+
 
 
 // Expand or contract a rectangle in width and/or height (equal
@@ -1408,6 +2152,19 @@ gslc_tsRect gslc_ExpandRect(gslc_tsRect rRect,int16_t nExpandW,int16_t nExpandH)
 }
 
 
+bool gslc_IsRectOverlap(gslc_tsRect rRect1,gslc_tsRect rRect2)
+{
+  if ((rRect1.w == 0) || (rRect1.h == 0) || (rRect2.w == 0) || (rRect2.h == 0)) {
+    return false;
+  }
+  if ( (rRect1.x < rRect2.x+(int16_t)rRect2.w) && (rRect2.x < rRect1.x+(int16_t)rRect1.w) &&
+     (rRect1.y < rRect2.y+(int16_t)rRect2.h) && (rRect2.y < rRect1.y+(int16_t)rRect1.h) ) {
+    return true;
+  } else {
+    return false;
+  }
+}
+
 // Expand the current rect (pRect) to enclose the additional rect region (rAddRect)
 void gslc_UnionRect(gslc_tsRect* pRect,gslc_tsRect rAddRect)
 {
@@ -1453,7 +2210,10 @@ void gslc_InvalidateRgnReset(gslc_tsGui* pGui)
   GSLC_DEBUG_PRINT("DBG: InvRgnReset\n", "");
 #endif
   pGui->bInvalidateEn = false;
-  pGui->rInvalidateRect = (gslc_tsRect) { 0, 0, 1, 1 };
+  pGui->nInvalidateRectCnt = 0;
+  for (uint8_t nInd = 0; nInd < GSLC_INVALIDATE_RECT_MAX; nInd++) {
+    pGui->abInvalidateBkgnd[nInd] = false;
+  }
 }
 
 void gslc_InvalidateRgnScreen(gslc_tsGui* pGui)
@@ -1462,7 +2222,9 @@ void gslc_InvalidateRgnScreen(gslc_tsGui* pGui)
   GSLC_DEBUG_PRINT("DBG: InvRgnScreen\n", "");
 #endif
   pGui->bInvalidateEn = true;
-  pGui->rInvalidateRect = (gslc_tsRect) { 0, 0, pGui->nDispW, pGui->nDispH };
+  pGui->nInvalidateRectCnt = 1;
+  pGui->asInvalidateRect[0] = (gslc_tsRect) { 0, 0, pGui->nDispW, pGui->nDispH };
+  pGui->abInvalidateBkgnd[0] = false;
 }
 
 void gslc_InvalidateRgnPage(gslc_tsGui* pGui, gslc_tsPage* pPage)
@@ -1476,85 +2238,208 @@ void gslc_InvalidateRgnPage(gslc_tsGui* pGui, gslc_tsPage* pPage)
     pPage->rBounds.x, pPage->rBounds.y, pPage->rBounds.x + pPage->rBounds.w - 1, pPage->rBounds.y + pPage->rBounds.h - 1); //xxx
 #endif // DBG_REDRAW
   gslc_InvalidateRgnAdd(pGui, pPage->rBounds);
-  pGui->bInvalidateEn = true;
 }
 
 
-void gslc_InvalidateRgnAdd(gslc_tsGui* pGui, gslc_tsRect rAddRect)
+// Add a rect region to the invalidation region list
+// - If bBkgnd is set, the background within the rect region has been
+//   exposed (eg. by hiding or moving an element) and requires redraw
+void gslc_InvalidateRgnAddBase(gslc_tsGui* pGui, gslc_tsRect rAddRect, bool bBkgnd)
 {
-  if (pGui->bInvalidateEn) {
-    gslc_UnionRect(&(pGui->rInvalidateRect), rAddRect);
-  } else {
+  uint8_t       nInd;
+  uint8_t       nIndBest;
+  int32_t       nCost,nCostBest;
+  int32_t       nAreaSum;
+  gslc_tsRect   rMerge;
+  gslc_tsRect*  pRect;
+
+  // Ignore empty regions
+  if ((rAddRect.w == 0) || (rAddRect.h == 0)) {
+    return;
+  }
+
+  if (!pGui->bInvalidateEn) {
     pGui->bInvalidateEn = true;
-    pGui->rInvalidateRect = rAddRect;
+    pGui->nInvalidateRectCnt = 0;
+  }
+
+  while (true) {
+    // Absorb any rects that overlap the new region
+    // - Merging grows the new region, which may then overlap rects
+    //   that were already checked, so restart the scan after each
+    //   merge. This keeps the list disjoint, ensuring that each
+    //   invalidated element is contained within a single rect.
+    nInd = 0;
+    while (nInd < pGui->nInvalidateRectCnt) {
+      pRect = &(pGui->asInvalidateRect[nInd]);
+      if (gslc_IsRectOverlap(*pRect,rAddRect)) {
+        gslc_UnionRect(&rAddRect,*pRect);
+        bBkgnd |= pGui->abInvalidateBkgnd[nInd];
+        // Remove the absorbed rect (order is not significant)
+        pGui->nInvalidateRectCnt--;
+        *pRect = pGui->asInvalidateRect[pGui->nInvalidateRectCnt];
+        pGui->abInvalidateBkgnd[nInd] = pGui->abInvalidateBkgnd[pGui->nInvalidateRectCnt];
+        nInd = 0;
+      } else {
+        nInd++;
+      }
+    }
+
+    if (pGui->nInvalidateRectCnt < GSLC_INVALIDATE_RECT_MAX) {
+      break;
+    }
+
+    // The list is full, so merge the new region with the rect
+    // that adds the least amount of area, then check for
+    // overlaps again.
+    nIndBest = 0;
+    nCostBest = 0;
+    for (nInd=0;nInd<pGui->nInvalidateRectCnt;nInd++) {
+      pRect = &(pGui->asInvalidateRect[nInd]);
+      rMerge = *pRect;
+      gslc_UnionRect(&rMerge,rAddRect);
+      nCost = (int32_t)rMerge.w * rMerge.h - (int32_t)pRect->w * pRect->h;
+      if ((nInd == 0) || (nCost < nCostBest)) {
+        nIndBest = nInd;
+        nCostBest = nCost;
+      }
+    }
+    gslc_UnionRect(&rAddRect,pGui->asInvalidateRect[nIndBest]);
+    bBkgnd |= pGui->abInvalidateBkgnd[nIndBest];
+    pGui->nInvalidateRectCnt--;
+    pGui->asInvalidateRect[nIndBest] = pGui->asInvalidateRect[pGui->nInvalidateRectCnt];
+    pGui->abInvalidateBkgnd[nIndBest] = pGui->abInvalidateBkgnd[pGui->nInvalidateRectCnt];
+  }
+
+  pGui->asInvalidateRect[pGui->nInvalidateRectCnt] = rAddRect;
+  pGui->abInvalidateBkgnd[pGui->nInvalidateRectCnt] = bBkgnd;
+  pGui->nInvalidateRectCnt++;
+
+  if (pGui->nInvalidateRectCnt < 2) {
+    return;
+  }
+
+  // If the rects cover most of their bounding rect, then the overhead
+  // of additional redraw passes outweighs the savings in area, so
+  // collapse the list into a single rect.
+  rMerge = pGui->asInvalidateRect[0];
+  nAreaSum = 0;
+  for (nInd=0;nInd<pGui->nInvalidateRectCnt;nInd++) {
+    pRect = &(pGui->asInvalidateRect[nInd]);
+    gslc_UnionRect(&rMerge,*pRect);
+    nAreaSum += (int32_t)pRect->w * pRect->h;
+    bBkgnd |= pGui->abInvalidateBkgnd[nInd];
+  }
+  if (nAreaSum * 100 >= (int32_t)rMerge.w * rMerge.h * GSLC_INVALIDATE_MERGE_PCT) {
+    pGui->asInvalidateRect[0] = rMerge;
+    pGui->abInvalidateBkgnd[0] = bBkgnd;
+    pGui->nInvalidateRectCnt = 1;
   }
 }
 
+void gslc_InvalidateRgnAdd(gslc_tsGui* pGui, gslc_tsRect rAddRect)
+{
+  gslc_InvalidateRgnAddBase(pGui, rAddRect, false);
+}
+
+void gslc_InvalidateRgnBkgnd(gslc_tsGui* pGui, gslc_tsRect rAddRect)
+{
+#if defined(DBG_REDRAW)
+  GSLC_DEBUG_PRINT("DBG: InvRgnBkgnd: (%d,%d)-(%d,%d)\n",
+    rAddRect.x, rAddRect.y, rAddRect.x + rAddRect.w - 1, rAddRect.y + rAddRect.h - 1);
+#endif // DBG_REDRAW
+  gslc_InvalidateRgnAddBase(pGui, rAddRect, true);
+}
+
 
 // Draw a circle using midpoint circle algorithm
 // - Algorithm reference: https://en.wikipedia.org/wiki/Midpoint_circle_algorithm
 void gslc_DrawFrameCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,
   uint16_t nRadius,gslc_tsColor nCol)
 {
+  gslc_tsRect rBound = (gslc_tsRect){(int16_t)(nMidX-nRadius),(int16_t)(nMidY-nRadius),
+    (uint16_t)(2*nRadius+1),(uint16_t)(2*nRadius+1)};
+  bool bInside;
+  if (!gslc_ClipBound(pGui,rBound,&bInside)) {
+    return;
+  }
 
   #if (DRV_HAS_DRAW_CIRCLE_FRAME)
+  if (bInside) {
     // Call optimized driver implementation
     gslc_DrvDrawFrameCircle(pGui,nMidX,nMidY,nRadius,nCol);
-  #else
-    // Emulate circle with point drawing
-
-    int16_t nX    = nRadius;
-    int16_t nY    = 0;
-    int16_t nErr  = 0;
+    gslc_PageFlipSet(pGui,true);
+    return;
+  }
+  #endif
 
-    #if (DRV_HAS_DRAW_POINTS)
-      gslc_tsPt asPt[8];
-      while (nX >= nY)
-      {
-        asPt[0] = (gslc_tsPt){nMidX + nX, nMidY + nY};
-        asPt[1] = (gslc_tsPt){nMidX + nY, nMidY + nX};
-        asPt[2] = (gslc_tsPt){nMidX - nY, nMidY + nX};
-        asPt[3] = (gslc_tsPt){nMidX - nX, nMidY + nY};
-        asPt[4] = (gslc_tsPt){nMidX - nX, nMidY - nY};
-        asPt[5] = (gslc_tsPt){nMidX - nY, nMidY - nX};
-        asPt[6] = (gslc_tsPt){nMidX + nY, nMidY - nX};
-        asPt[7] = (gslc_tsPt){nMidX + nX, nMidY - nY};
-        gslc_DrvDrawPoints(pGui,asPt,8,nCol);
-
-        nY    += 1;
-        nErr  += 1 + 2*nY;
-        if (2*(nErr-nX) + 1 > 0)
-        {
-            nX -= 1;
-            nErr += 1 - 2*nX;
+  // Emulate circle with point drawing
+
+  #if (DRV_HAS_DRAW_POINTS)
+    int16_t   nX    = nRadius;
+    int16_t   nY    = 0;
+    int16_t   nErr  = 0;
+    gslc_tsPt asPt[8];
+    uint8_t   nPtCnt;
+    #if (GSLC_CLIP_EN)
+    gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+    uint8_t   nPtInd,nPtTotal;
+    #endif
+    while (nX >= nY)
+    {
+      // Points on the axes and on the diagonals are shared by
+      // two octants, so they are only added once
+      nPtCnt = 0;
+      asPt[nPtCnt++] = (gslc_tsPt){nMidX + nX, nMidY + nY};
+      if (nY == 0) {
+        if (nX > 0) {
+          asPt[nPtCnt++] = (gslc_tsPt){nMidX, nMidY + nX};
+          asPt[nPtCnt++] = (gslc_tsPt){nMidX - nX, nMidY};
+          asPt[nPtCnt++] = (gslc_tsPt){nMidX, nMidY - nX};
         }
-      } // while
+      } else {
+        asPt[nPtCnt++] = (gslc_tsPt){nMidX - nX, nMidY + nY};
+        asPt[nPtCnt++] = (gslc_tsPt){nMidX - nX, nMidY - nY};
+        asPt[nPtCnt++] = (gslc_tsPt){nMidX + nX, nMidY - nY};
+        if (nX != nY) {
+          asPt[nPtCnt++] = (gslc_tsPt){nMidX + nY, nMidY + nX};
+          asPt[nPtCnt++] = (gslc_tsPt){nMidX - nY, nMidY + nX};
+          asPt[nPtCnt++] = (gslc_tsPt){nMidX - nY, nMidY - nX};
+          asPt[nPtCnt++] = (gslc_tsPt){nMidX + nY, nMidY - nX};
+        }
+      }
+      #if (GSLC_CLIP_EN)
+      if (!bInside) {
+        // Drop the points that lie outside the clipping region
+        nPtTotal = nPtCnt;
+        nPtCnt = 0;
+        for (nPtInd=0;nPtInd<nPtTotal;nPtInd++) {
+          if (gslc_ClipPt(&(pDriver->rClipRect),asPt[nPtInd].x,asPt[nPtInd].y)) {
+            asPt[nPtCnt++] = asPt[nPtInd];
+          }
+        }
+      }
+      #endif
+      if (nPtCnt > 0) {
+        gslc_DrvDrawPoints(pGui,asPt,nPtCnt,nCol);
+      }
 
-    #elif (DRV_HAS_DRAW_POINT)
-      while (nX >= nY)
+      nY    += 1;
+      nErr  += 1 + 2*nY;
+      if (2*(nErr-nX) + 1 > 0)
       {
-        gslc_DrvDrawPoint(pGui,nMidX + nX, nMidY + nY,nCol);
-        gslc_DrvDrawPoint(pGui,nMidX + nY, nMidY + nX,nCol);
-        gslc_DrvDrawPoint(pGui,nMidX - nY, nMidY + nX,nCol);
-        gslc_DrvDrawPoint(pGui,nMidX - nX, nMidY + nY,nCol);
-        gslc_DrvDrawPoint(pGui,nMidX - nX, nMidY - nY,nCol);
-        gslc_DrvDrawPoint(pGui,nMidX - nY, nMidY - nX,nCol);
-        gslc_DrvDrawPoint(pGui,nMidX + nY, nMidY - nX,nCol);
-        gslc_DrvDrawPoint(pGui,nMidX + nX, nMidY - nY,nCol);
-
-        nY    += 1;
-        nErr  += 1 + 2*nY;
-        if (2*(nErr-nX) + 1 > 0)
-        {
-            nX -= 1;
-            nErr += 1 - 2*nX;
-        }
-      } // while
+          nX -= 1;
+          nErr += 1 - 2*nX;
+      }
+    } // while
 
-    #else
-      // ERROR
-    #endif
+  #elif (DRV_HAS_DRAW_POINT)
+    // A circle is a rounded rect whose corners meet, so the
+    // octants are drawn as runs of horizontal and vertical lines
+    gslc_DrawFrameRoundRectArcs(pGui,rBound,(int16_t)nRadius,gslc_DrvColorToRaw(pGui,nCol));
 
+  #else
+    // ERROR
   #endif
 
   gslc_PageFlipSet(pGui,true);
@@ -1567,83 +2452,488 @@ void gslc_DrawFrameCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,
 void gslc_DrawFillCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,
   uint16_t nRadius,gslc_tsColor nCol)
 {
+  gslc_tsRect rBound = (gslc_tsRect){(int16_t)(nMidX-nRadius),(int16_t)(nMidY-nRadius),
+    (uint16_t)(2*nRadius+1),(uint16_t)(2*nRadius+1)};
+  bool bInside;
+  if (!gslc_ClipBound(pGui,rBound,&bInside)) {
+    return;
+  }
 
   #if (DRV_HAS_DRAW_CIRCLE_FILL)
+  if (bInside) {
     // Call optimized driver implementation
     gslc_DrvDrawFillCircle(pGui,nMidX,nMidY,nRadius,nCol);
-  #else
-    // Emulate circle with line drawing
+    gslc_PageFlipSet(pGui,true);
+    return;
+  }
+  #endif
 
-    int16_t nX    = nRadius;  // a
-    int16_t nY    = 0;        // b
-    int16_t nErr  = 0;
+  // Emulate circle with spans
+  // - A circle is a rounded rect whose corners meet
+  gslc_DrawFillRoundRectSpans(pGui,rBound,(int16_t)nRadius,gslc_DrvColorToRaw(pGui,nCol));
+  gslc_DrawSpanFlush(pGui);
 
-    while (nX >= nY)
-    {
+  gslc_PageFlipSet(pGui,true);
+}
 
-      // Connect pairs of the reflected points around the circumference
 
-      //gslc_DrvDrawPoint(pGui,nMidX - nY, nMidY + nX,nCol);  // (-b,+a)
-      //gslc_DrvDrawPoint(pGui,nMidX + nY, nMidY + nX,nCol);  // (+b,+a)
-      gslc_DrawLine(pGui,nMidX-nY,nMidY+nX,nMidX+nY,nMidY+nX,nCol);
+// Draw a triangle
+void gslc_DrawFrameTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
+    int16_t nX1,int16_t nY1,int16_t nX2,int16_t nY2,gslc_tsColor nCol)
+{
+  bool bInside;
+  if (!gslc_ClipBound(pGui,gslc_GetTriangleBound(nX0,nY0,nX1,nY1,nX2,nY2),&bInside)) {
+    return;
+  }
 
-      //gslc_DrvDrawPoint(pGui,nMidX - nX, nMidY + nY,nCol);  // (-a,+b)
-      //gslc_DrvDrawPoint(pGui,nMidX + nX, nMidY + nY,nCol);  // (+a,+b)
-      gslc_DrawLine(pGui,nMidX-nX,nMidY+nY,nMidX+nX,nMidY+nY,nCol);
+  #if (DRV_HAS_DRAW_TRI_FRAME)
+  if (bInside) {
+    // Call optimized driver implementation
+    gslc_DrvDrawFrameTriangle(pGui,nX0,nY0,nX1,nY1,nX2,nY2,nCol);
+    gslc_PageFlipSet(pGui,true);
+    return;
+  }
+  #endif
 
-      //gslc_DrvDrawPoint(pGui,nMidX - nX, nMidY - nY,nCol);  // (-a,-b)
-      //gslc_DrvDrawPoint(pGui,nMidX + nX, nMidY - nY,nCol);  // (+a,-b)
-      gslc_DrawLine(pGui,nMidX-nX,nMidY-nY,nMidX+nX,nMidY-nY,nCol);
+  // Draw triangle with three lines
+  gslc_DrawLine(pGui,nX0,nY0,nX1,nY1,nCol);
+  gslc_DrawLine(pGui,nX1,nY1,nX2,nY2,nCol);
+  gslc_DrawLine(pGui,nX2,nY2,nX0,nY0,nCol);
 
-      //gslc_DrvDrawPoint(pGui,nMidX - nY, nMidY - nX,nCol);  // (-b,-a)
-      //gslc_DrvDrawPoint(pGui,nMidX + nY, nMidY - nX,nCol);  // (+b,-a)
-      gslc_DrawLine(pGui,nMidX-nY,nMidY-nX,nMidX+nY,nMidY-nX,nCol);
+  gslc_PageFlipSet(pGui,true);
+}
 
+gslc_tsRect gslc_GetTriangleBound(int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,int16_t nX2,int16_t nY2)
+{
+  int16_t nXMin = nX0;
+  int16_t nXMax = nX0;
+  int16_t nYMin = nY0;
+  int16_t nYMax = nY0;
+  if (nX1 < nXMin) { nXMin = nX1; }
+  if (nX1 > nXMax) { nXMax = nX1; }
+  if (nX2 < nXMin) { nXMin = nX2; }
+  if (nX2 > nXMax) { nXMax = nX2; }
+  if (nY1 < nYMin) { nYMin = nY1; }
+  if (nY1 > nYMax) { nYMax = nY1; }
+  if (nY2 < nYMin) { nYMin = nY2; }
+  if (nY2 > nYMax) { nYMax = nY2; }
+  return (gslc_tsRect){nXMin,nYMin,(uint16_t)(nXMax-nXMin+1),(uint16_t)(nYMax-nYMin+1)};
+}
 
-      nY    += 1;
-      nErr  += 1 + 2*nY;
-      if (2*(nErr-nX) + 1 > 0)
-      {
-          nX -= 1;
-          nErr += 1 - 2*nX;
-      }
-    } // while
+void gslc_SwapCoords(int16_t* pnXa,int16_t* pnYa,int16_t* pnXb,int16_t* pnYb)
+{
+  int16_t nSwapX,nSwapY;
+  nSwapX = *pnXa;
+  nSwapY = *pnYa;
+  *pnXa = *pnXb;
+  *pnYa = *pnYb;
+  *pnXb = nSwapX;
+  *pnYb = nSwapY;
+}
 
+void gslc_DrawSpanAdd(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nW,gslc_tsColorRaw nColRaw)
+{
+  if (nW == 0) {
+    return;
+  }
+  // Spans in the buffer share a single color
+  if ((pGui->nSpanBufCnt > 0) && (pGui->nSpanBufColRaw != nColRaw)) {
+    gslc_DrawSpanFlush(pGui);
+  }
+  if (pGui->nSpanBufCnt >= GSLC_SPAN_BUF_MAX) {
+    gslc_DrawSpanFlush(pGui);
+  }
+  gslc_tsSpan* pSpan = &(pGui->asSpanBuf[pGui->nSpanBufCnt]);
+  pSpan->nX = nX;
+  pSpan->nY = nY;
+  pSpan->nW = nW;
+  pGui->nSpanBufColRaw = nColRaw;
+  pGui->nSpanBufCnt++;
+}
 
+void gslc_DrawSpanFlush(gslc_tsGui* pGui)
+{
+#if (GSLC_CLIP_EN)
+  // Trim the spans to the clipping region, dropping any that
+  // fall outside it
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsRect*  pClipRect = &(pDriver->rClipRect);
+  int16_t       nCX0 = pClipRect->x;
+  int16_t       nCY0 = pClipRect->y;
+  int16_t       nCX1 = pClipRect->x + pClipRect->w - 1;
+  int16_t       nCY1 = pClipRect->y + pClipRect->h - 1;
+  int16_t       nSX0,nSX1;
+  uint16_t      nSpanRd;
+  uint16_t      nSpanWr = 0;
+  gslc_tsSpan*  pSpanRd;
+  for (nSpanRd=0;nSpanRd<pGui->nSpanBufCnt;nSpanRd++) {
+    pSpanRd = &(pGui->asSpanBuf[nSpanRd]);
+    if ((pSpanRd->nY < nCY0) || (pSpanRd->nY > nCY1)) {
+      continue;
+    }
+    nSX0 = (pSpanRd->nX < nCX0)? nCX0 : pSpanRd->nX;
+    nSX1 = pSpanRd->nX + pSpanRd->nW - 1;
+    nSX1 = (nSX1 > nCX1)? nCX1 : nSX1;
+    if (nSX1 < nSX0) {
+      continue;
+    }
+    pGui->asSpanBuf[nSpanWr].nX = nSX0;
+    pGui->asSpanBuf[nSpanWr].nY = pSpanRd->nY;
+    pGui->asSpanBuf[nSpanWr].nW = nSX1 - nSX0 + 1;
+    nSpanWr++;
+  }
+  pGui->nSpanBufCnt = nSpanWr;
+#endif // GSLC_CLIP_EN
+
+  if (pGui->nSpanBufCnt == 0) {
+    return;
+  }
+
+  #if (DRV_HAS_DRAW_SPANS)
+    // Call optimized driver implementation
+    gslc_DrvDrawSpans(pGui,pGui->asSpanBuf,pGui->nSpanBufCnt,pGui->nSpanBufColRaw);
+  #else
+    // Emulate with a single-row rect fill per span
+    uint16_t    nSpanInd;
+    gslc_tsSpan* pSpan;
+    gslc_tsRect rSpan;
+    for (nSpanInd=0;nSpanInd<pGui->nSpanBufCnt;nSpanInd++) {
+      pSpan = &(pGui->asSpanBuf[nSpanInd]);
+      rSpan = (gslc_tsRect){pSpan->nX,pSpan->nY,pSpan->nW,1};
+      gslc_DrawFillRectRaw(pGui,rSpan,pGui->nSpanBufColRaw);
+    }
   #endif
 
+  pGui->nSpanBufCnt = 0;
   gslc_PageFlipSet(pGui,true);
 }
 
+void gslc_EdgeStepInit(gslc_tsEdgeStep* pEdge,int16_t nXa,int16_t nYa,int16_t nXb,int16_t nYb)
+{
+  int32_t nDX = (int32_t)nXb - nXa;
+  pEdge->nX     = nXa;
+  pEdge->bPos   = (nDX >= 0);
+  pEdge->nDY    = (int32_t)nYb - nYa;
+  nDX           = (nDX >= 0)? nDX : -nDX;
+  pEdge->nStepQ = nDX / pEdge->nDY;
+  pEdge->nStepR = nDX % pEdge->nDY;
+  pEdge->nOfs   = 0;
+  pEdge->nFrac  = 0;
+}
+
+int16_t gslc_EdgeStepGetX(gslc_tsEdgeStep* pEdge)
+{
+  int32_t nOfs = pEdge->nOfs + ((2*pEdge->nFrac >= pEdge->nDY)? 1 : 0);
+  return (int16_t)((pEdge->bPos)? pEdge->nX + nOfs : pEdge->nX - nOfs);
+}
+
+void gslc_EdgeStepNext(gslc_tsEdgeStep* pEdge)
+{
+  pEdge->nOfs  += pEdge->nStepQ;
+  pEdge->nFrac += pEdge->nStepR;
+  if (pEdge->nFrac >= pEdge->nDY) {
+    pEdge->nFrac -= pEdge->nDY;
+    pEdge->nOfs++;
+  }
+}
+
+void gslc_DrawFillTriangleSpans(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
+    int16_t nX1,int16_t nY1,int16_t nX2,int16_t nY2,bool bSkipEdge01,gslc_tsColorRaw nColRaw)
+{
+  // Algorithm:
+  // - Sort the vertices so that nY0 <= nY1 <= nY2
+  // - The long edge (0-2) bounds every row on one side. The rows
+  //   above Y1 are bounded on the other side by edge 0-1 and the
+  //   remaining rows by edge 1-2.
+  // - Each edge is stepped incrementally from its upper vertex so
+  //   that an edge shared with an adjacent triangle yields the
+  //   same X on every row (no gap along the seam)
+  // - If requested, the pixels of edge 0-1 are left out of each row
+  //   so that a shared edge that was already filled isn't drawn twice
+  // - As before, the bottom row (Y2) is excluded
+  gslc_tsEdgeStep sEdgeSkip;
+  int16_t         nYSkip0 = 0;
+  int16_t         nYSkip1 = 0;
+  if (bSkipEdge01) {
+    // A horizontal edge lies on the bottom row of one of the two
+    // triangles that share it, so it never needs to be skipped
+    if (nY0 < nY1) {
+      gslc_EdgeStepInit(&sEdgeSkip,nX0,nY0,nX1,nY1);
+      nYSkip0 = nY0; nYSkip1 = nY1;
+    } else if (nY1 < nY0) {
+      gslc_EdgeStepInit(&sEdgeSkip,nX1,nY1,nX0,nY0);
+      nYSkip0 = nY1; nYSkip1 = nY0;
+    }
+  }
 
-// Draw a triangle
-void gslc_DrawFrameTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
-    int16_t nX1,int16_t nY1,int16_t nX2,int16_t nY2,gslc_tsColor nCol)
+  if (nY0>nY1) { gslc_SwapCoords(&nX0,&nY0,&nX1,&nY1); }
+  if (nY1>nY2) { gslc_SwapCoords(&nX1,&nY1,&nX2,&nY2); }
+  if (nY0>nY1) { gslc_SwapCoords(&nX0,&nY0,&nX1,&nY1); }
+
+  if (nY0 == nY2) {
+    // Degenerate triangle covers no rows
+    return;
+  }
+
+  gslc_tsEdgeStep sEdgeLong;
+  gslc_tsEdgeStep sEdgeShort;
+  int16_t         nY,nYEnd,nXa,nXb,nXSkip,nSwap;
+
+  gslc_EdgeStepInit(&sEdgeLong,nX0,nY0,nX2,nY2);
+  if (nY1 > nY0) {
+    gslc_EdgeStepInit(&sEdgeShort,nX0,nY0,nX1,nY1);
+  } else {
+    gslc_EdgeStepInit(&sEdgeShort,nX1,nY1,nX2,nY2);
+  }
+
+  nY = nY0;
+  while (nY < nY2) {
+    // Switch to the lower short edge at the middle vertex
+    nYEnd = (nY < nY1)? nY1 : nY2;
+    if ((nY == nY1) && (nY1 > nY0)) {
+      gslc_EdgeStepInit(&sEdgeShort,nX1,nY1,nX2,nY2);
+    }
+    for (;nY<nYEnd;nY++) {
+      nXa = gslc_EdgeStepGetX(&sEdgeLong);
+      nXb = gslc_EdgeStepGetX(&sEdgeShort);
+      if (nXa > nXb) { nSwap = nXa; nXa = nXb; nXb = nSwap; }
+      if ((nY >= nYSkip0) && (nY < nYSkip1)) {
+        // Trim the end of the span that lies on the skipped edge
+        nXSkip = gslc_EdgeStepGetX(&sEdgeSkip);
+        gslc_EdgeStepNext(&sEdgeSkip);
+        if (nXa == nXSkip) {
+          nXa++;
+        } else if (nXb == nXSkip) {
+          nXb--;
+        }
+      }
+      if (nXa <= nXb) {
+        gslc_DrawSpanAdd(pGui,nXa,nY,(uint16_t)(nXb-nXa+1),nColRaw);
+      }
+      gslc_EdgeStepNext(&sEdgeLong);
+      gslc_EdgeStepNext(&sEdgeShort);
+    }
+  }
+}
+
+// Row extent sentinels used by the annulus rasterizer
+#define GSLC_ARC_X_MIN  (-32767)
+#define GSLC_ARC_X_MAX  (32767)
+
+// Determine the pixels on row nY (relative to the circle center) that lie
+// in the half-plane spanning the 180 degrees clockwise from the ray
+// (nDX,nDY), with pixels on the ray itself included and those on the
+// opposite ray excluded. The result is the inclusive range
+// [*pnXMin,*pnXMax], which is empty if *pnXMin > *pnXMax.
+void gslc_ArcHalfPlaneRow(int16_t nDX,int16_t nDY,int16_t nY,int16_t* pnXMin,int16_t* pnXMax)
+{
+  // A pixel (x,y) is clockwise from the ray if the cross product
+  // nDX*y - nDY*x is positive. When it is zero, the pixel is on
+  // the ray if the dot product nDX*x + nDY*y is positive.
+  int32_t nNum = (int32_t)nDX * nY;
+  int32_t nDen,nQuot;
+  bool    bExact,bOnRay;
+
+  *pnXMin = GSLC_ARC_X_MIN;
+  *pnXMax = GSLC_ARC_X_MAX;
+  if (nDY == 0) {
+    if (nY != 0) {
+      if (nNum <= 0) { *pnXMin = 1; *pnXMax = 0; }
+    } else if (nDX > 0) {
+      *pnXMin = 1;
+    } else {
+      *pnXMax = -1;
+    }
+  } else {
+    // Solve for the column where the cross product changes sign
+    nDen   = (nDY > 0)? nDY : -nDY;
+    nNum   = (nDY > 0)? nNum : -nNum;
+    nQuot  = nNum / nDen;
+    bExact = (nNum % nDen == 0);
+    if ((!bExact) && (nNum < 0)) {
+      nQuot--;
+    }
+    // Include the boundary column if it lies exactly on the ray
+    bOnRay = bExact && ((int32_t)nDX * nQuot + (int32_t)nDY * nY > 0);
+    if (nDY > 0) {
+      *pnXMax = (int16_t)((bExact && !bOnRay)? nQuot-1 : nQuot);
+    } else {
+      *pnXMin = (int16_t)((bOnRay)? nQuot : nQuot+1);
+    }
+  }
+
+  // The center pixel has no angle, so it is treated as lying just above
+  // the center (at 0 degrees). It then belongs to exactly one of a set
+  // of adjoining sectors.
+  if ((nY == 0) && ((nDX < 0) || ((nDX == 0) && (nDY < 0)))) {
+    if (*pnXMax == -1) { *pnXMax = 0; }
+    if (*pnXMin == 1)  { *pnXMin = 0; }
+  }
+}
+
+// Update the outermost X of the ring (*pnXOuter) and of its hole
+// (*pnXInner, -1 if the row misses the hole) for a row at distance
+// nYSq=y*y from the center, starting from the values of a nearby row
+// - Pixels are kept whose center lies within half a pixel of the radii
+//   Outer: x*x+y*y <= (nRad2+0.5)^2, ie. <= nRad2*nRad2+nRad2
+//   Hole:  x*x+y*y <  (nRad1-0.5)^2, ie. <= nRad1*nRad1-nRad1
+void gslc_RingRowExtent(int16_t nRad1,int16_t nRad2,int32_t nYSq,int16_t* pnXOuter,int16_t* pnXInner)
 {
+  int32_t nHoleSq = (nRad1 > 0)? (int32_t)nRad1*nRad1 - nRad1 : -1;
+  int32_t nRingSq = (int32_t)nRad2*nRad2 + nRad2;
+  int16_t nXOuter = *pnXOuter;
+  int16_t nXInner = *pnXInner;
 
-  #if (DRV_HAS_DRAW_TRI_FRAME)
-    // Call optimized driver implementation
-    gslc_DrvDrawFrameTriangle(pGui,nX0,nY0,nX1,nY1,nX2,nY2,nCol);
-  #else
-    // Draw triangle with three lines
-    gslc_DrawLine(pGui,nX0,nY0,nX1,nY1,nCol);
-    gslc_DrawLine(pGui,nX1,nY1,nX2,nY2,nCol);
-    gslc_DrawLine(pGui,nX2,nY2,nX0,nY0,nCol);
+  while ((int32_t)(nXOuter+1)*(nXOuter+1) + nYSq <= nRingSq) { nXOuter++; }
+  while ((nXOuter > 0) && ((int32_t)nXOuter*nXOuter + nYSq > nRingSq)) { nXOuter--; }
+  if (nYSq <= nHoleSq) {
+    if (nXInner < 0) { nXInner = 0; }
+    while ((int32_t)(nXInner+1)*(nXInner+1) + nYSq <= nHoleSq) { nXInner++; }
+    while ((nXInner > 0) && ((int32_t)nXInner*nXInner + nYSq > nHoleSq)) { nXInner--; }
+  } else {
+    nXInner = -1;
+  }
+  *pnXOuter = nXOuter;
+  *pnXInner = nXInner;
+}
 
-  #endif
+void gslc_DrawFillArcSpans(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,int16_t nRad1,int16_t nRad2,
+    int16_t n64AngStart,int32_t n64AngRange,gslc_tsPt* psRay,gslc_tsRingGeom* pGeom,gslc_tsColorRaw nColRaw)
+{
+  // Algorithm:
+  // - Each row of the ring is one interval between the outer circle
+  //   edges, or two if the row passes through the inner hole
+  // - The sector is the intersection (range up to 180 degrees) or the
+  //   union (larger ranges) of the half-plane after the start ray and
+  //   the complement of the half-plane after the end ray. On any row
+  //   each half-plane is a single interval, found with one division.
+  // - The ring intervals are clipped to the sector intervals and
+  //   emitted as spans
+  if ((n64AngRange <= 0) || (nRad2 < 0)) {
+    return;
+  }
+  if (nRad1 < 0) {
+    nRad1 = 0;
+  }
+  if (nRad1 > nRad2) {
+    return;
+  }
+  bool    bFull = (n64AngRange >= 360*64);
+  int16_t n64AngEnd;
+  int16_t nDX0 = 0, nDY0 = 0, nDX1 = 0, nDY1 = 0;
+  int16_t nRowMin = -nRad2;
+  int16_t nRowMax = nRad2;
+
+  n64AngStart = (int16_t)(((int32_t)n64AngStart % (360*64) + 360*64) % (360*64));
+  if (!bFull) {
+    if (psRay) {
+      nDX0 = psRay[0].x;
+      nDY0 = psRay[0].y;
+      nDX1 = psRay[1].x;
+      nDY1 = psRay[1].y;
+    } else {
+      n64AngEnd = (int16_t)(((int32_t)n64AngStart + n64AngRange) % (360*64));
+      gslc_SinCosFX(n64AngStart,&nDX0,&nDY0);
+      gslc_SinCosFX(n64AngEnd,&nDX1,&nDY1);
+      nDY0 = -nDY0;
+      nDY1 = -nDY1;
+    }
+
+    // Limit the rows to the bounding box of the sector: the corners,
+    // plus the top or bottom of the circle if the sector includes them
+    int16_t nCornerY[4];
+    int16_t nInd;
+    nCornerY[0] = (int32_t)nRad1 * nDY0 / 32767;
+    nCornerY[1] = (int32_t)nRad2 * nDY0 / 32767;
+    nCornerY[2] = (int32_t)nRad1 * nDY1 / 32767;
+    nCornerY[3] = (int32_t)nRad2 * nDY1 / 32767;
+    nRowMin = nCornerY[0];
+    nRowMax = nCornerY[0];
+    for (nInd=1;nInd<4;nInd++) {
+      nRowMin = (nCornerY[nInd] < nRowMin)? nCornerY[nInd] : nRowMin;
+      nRowMax = (nCornerY[nInd] > nRowMax)? nCornerY[nInd] : nRowMax;
+    }
+    if ((360*64 - n64AngStart) % (360*64) < n64AngRange) {
+      nRowMin = -nRad2;
+    }
+    if ((180*64 - n64AngStart + 360*64) % (360*64) < n64AngRange) {
+      nRowMax = nRad2;
+    }
+    // Allow for rounding of the corners
+    nRowMin = (nRowMin-1 < -nRad2)? -nRad2 : nRowMin-1;
+    nRowMax = (nRowMax+1 >  nRad2)?  nRad2 : nRowMax+1;
+  }
+
+  int16_t nXOuter = 0;   // Outermost X in ring
+  int16_t nXInner = -1;  // Outermost X in hole
+  int16_t anRingMin[2],anRingMax[2],anSecMin[2],anSecMax[2];
+  int16_t nRingCnt,nSecCnt,nRingInd,nSecInd;
+  int16_t nXMin0,nXMax0,nXMin1,nXMax1,nXMin,nXMax;
+  int16_t nY;
+
+  for (nY=nRowMin;nY<=nRowMax;nY++) {
+    // Fetch the ring extents from the retained geometry, or else
+    // track them incrementally from the previous row
+    if (pGeom) {
+      nXOuter = pGeom->anRowOuter[(nY < 0)? -nY : nY];
+      nXInner = pGeom->anRowInner[(nY < 0)? -nY : nY];
+    } else {
+      gslc_RingRowExtent(nRad1,nRad2,(int32_t)nY*nY,&nXOuter,&nXInner);
+    }
+    if (nXInner < 0) {
+      nRingCnt = 1;
+      anRingMin[0] = -nXOuter; anRingMax[0] = nXOuter;
+    } else {
+      nRingCnt = 2;
+      anRingMin[0] = -nXOuter;   anRingMax[0] = -nXInner-1;
+      anRingMin[1] = nXInner+1;  anRingMax[1] = nXOuter;
+    }
 
-  gslc_PageFlipSet(pGui,true);
-}
+    // Determine the sector intervals on this row
+    if (bFull) {
+      nSecCnt = 1;
+      anSecMin[0] = GSLC_ARC_X_MIN; anSecMax[0] = GSLC_ARC_X_MAX;
+    } else {
+      gslc_ArcHalfPlaneRow(nDX0,nDY0,nY,&nXMin0,&nXMax0);
+      gslc_ArcHalfPlaneRow(nDX1,nDY1,nY,&nXMin1,&nXMax1);
+      // Complement of the end half-plane (at most one side is bounded)
+      if (nXMin1 > nXMax1) {
+        nXMin1 = GSLC_ARC_X_MIN; nXMax1 = GSLC_ARC_X_MAX;
+      } else if ((nXMin1 == GSLC_ARC_X_MIN) && (nXMax1 == GSLC_ARC_X_MAX)) {
+        nXMin1 = 1; nXMax1 = 0;
+      } else if (nXMin1 == GSLC_ARC_X_MIN) {
+        nXMin1 = nXMax1+1; nXMax1 = GSLC_ARC_X_MAX;
+      } else {
+        nXMax1 = nXMin1-1; nXMin1 = GSLC_ARC_X_MIN;
+      }
+      if (n64AngRange <= 180*64) {
+        nSecCnt = 1;
+        anSecMin[0] = (nXMin0 > nXMin1)? nXMin0 : nXMin1;
+        anSecMax[0] = (nXMax0 < nXMax1)? nXMax0 : nXMax1;
+      } else if ((nXMin0 > nXMax0) || (nXMin1 > nXMax1) ||
+          (nXMax0 < nXMin1-1) || (nXMax1 < nXMin0-1)) {
+        // Disjoint (or empty) intervals
+        nSecCnt = 2;
+        anSecMin[0] = nXMin0; anSecMax[0] = nXMax0;
+        anSecMin[1] = nXMin1; anSecMax[1] = nXMax1;
+      } else {
+        nSecCnt = 1;
+        anSecMin[0] = (nXMin0 < nXMin1)? nXMin0 : nXMin1;
+        anSecMax[0] = (nXMax0 > nXMax1)? nXMax0 : nXMax1;
+      }
+    }
 
-void gslc_SwapCoords(int16_t* pnXa,int16_t* pnYa,int16_t* pnXb,int16_t* pnYb)
-{
-  int16_t nSwapX,nSwapY;
-  nSwapX = *pnXa;
-  nSwapY = *pnYa;
-  *pnXa = *pnXb;
-  *pnYa = *pnYb;
-  *pnXb = nSwapX;
-  *pnYb = nSwapY;
+    // Emit the intersection of the ring and sector intervals
+    for (nRingInd=0;nRingInd<nRingCnt;nRingInd++) {
+      for (nSecInd=0;nSecInd<nSecCnt;nSecInd++) {
+        nXMin = (anRingMin[nRingInd] > anSecMin[nSecInd])? anRingMin[nRingInd] : anSecMin[nSecInd];
+        nXMax = (anRingMax[nRingInd] < anSecMax[nSecInd])? anRingMax[nRingInd] : anSecMax[nSecInd];
+        if (nXMin <= nXMax) {
+          gslc_DrawSpanAdd(pGui,nMidX+nXMin,nMidY+nY,(uint16_t)(nXMax-nXMin+1),nColRaw);
+        }
+      }
+    }
+  }
 }
 
 
@@ -1651,87 +2941,24 @@ void gslc_SwapCoords(int16_t* pnXa,int16_t* pnYa,int16_t* pnXb,int16_t* pnYb)
 void gslc_DrawFillTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
     int16_t nX1,int16_t nY1,int16_t nX2,int16_t nY2,gslc_tsColor nCol)
 {
+  bool bInside;
+  if (!gslc_ClipBound(pGui,gslc_GetTriangleBound(nX0,nY0,nX1,nY1,nX2,nY2),&bInside)) {
+    return;
+  }
 
   #if (DRV_HAS_DRAW_TRI_FILL)
+  if (bInside) {
     // Call optimized driver implementation
     gslc_DrvDrawFillTriangle(pGui,nX0,nY0,nX1,nY1,nX2,nY2,nCol);
-
-  #else
-    // Emulate triangle fill
-
-    // Algorithm:
-    // - An arbitrary triangle is cut into two portions:
-    //   1) a flat bottom triangle
-    //   2) a flat top triangle
-    // - Sort the vertices in descending vertical position.
-    //   This serves two purposes:
-    //   1) ensures that the division between the flat bottom
-    //      and flat top triangles occurs at Y=Y1
-    //   2) ensure that we avoid division-by-zero in the for loops
-    // - Walk each scan line and determine the intersection
-    //   between triangle side A & B (flat bottom triangle)
-    //   and then C and B (flat top triangle) using line slopes.
-
-    // Sort vertices
-    // - Want nY0 >= nY1 >= nY2
-    if (nY2>nY1) { gslc_SwapCoords(&nX2,&nY2,&nX1,&nY1); }
-    if (nY1>nY0) { gslc_SwapCoords(&nX0,&nY0,&nX1,&nY1); }
-    if (nY2>nY1) { gslc_SwapCoords(&nX2,&nY2,&nX1,&nY1); }
-
-    // TODO: It is more efficient to calculate row endpoints
-    // using incremental additions instead of multiplies/divides
-
-    int16_t nXa,nXb,nXc,nYos;
-    int16_t nX01,nX20,nY01,nY20,nX21,nY21;
-    nX01 = nX0-nX1; nY01 = nY0-nY1;
-    nX20 = nX2-nX0; nY20 = nY2-nY0;
-    nX21 = nX2-nX1; nY21 = nY2-nY1;
-
-    // Flat bottom scenario
-    // NOTE: Due to vertex sorting and loop range, it shouldn't
-    // be possible to enter loop when nY0 == nY1 or nY2
-    for (nYos=0;nYos<nY01;nYos++) {
-      // Determine row endpoints (no rounding)
-      //nXa = (nYos          )*(nX0-nX1)/(nY0-nY1);
-      //nXb = (nYos-(nY0-nY1))*(nX2-nX0)/(nY2-nY0);
-
-      // Determine row endpoints (using rounding)
-      nXa  = 2*(nYos)*nX01;
-      nXa += (nXa>=0)?abs(nY01):-abs(nY01);
-      nXa /= 2*nY01;
-
-      nXb = 2*(nYos-nY01)*nX20;
-      nXb += (nXb>=0)?abs(nY20):-abs(nY20);
-      nXb /= 2*nY20;
-
-      // Draw horizontal line between endpoints
-      gslc_DrawLine(pGui,nX1+nXa,nY1+nYos,nX0+nXb,nY1+nYos,nCol);
-    }
-
-    // Flat top scenario
-    // NOTE: Due to vertex sorting and loop range, it shouldn't
-    // be possible to enter loop when nY2 == nY0 or nY1
-    for (nYos=nY21;nYos<0;nYos++) {
-
-      // Determine row endpoints (no rounding)
-      //nXc = (nYos          )*(nX2-nX1)/(nY2-nY1);
-      //nXb = (nYos-(nY0-nY1))*(nX2-nX0)/(nY2-nY0);
-
-      // Determine row endpoints (using rounding)
-      nXc  = 2*(nYos)*nX21;
-      nXc += (nXc>=0)?abs(nY21):-abs(nY21);
-      nXc /= 2*nY21;
-
-      nXb = 2*(nYos-nY01)*nX20;
-      nXb += (nXb>=0)?abs(nY20):-abs(nY20);
-      nXb /= 2*nY20;
-
-      // Draw horizontal line between endpoints
-      gslc_DrawLine(pGui,nX1+nXc,nY1+nYos,nX0+nXb,nY1+nYos,nCol);
-    }
-
+    gslc_PageFlipSet(pGui,true);
+    return;
+  }
   #endif  // DRV_HAS_DRAW_TRI_FILL
 
+  // Emulate triangle fill
+  gslc_DrawFillTriangleSpans(pGui,nX0,nY0,nX1,nY1,nX2,nY2,false,gslc_DrvColorToRaw(pGui,nCol));
+  gslc_DrawSpanFlush(pGui);
+
   gslc_PageFlipSet(pGui,true);
 }
 
@@ -1757,8 +2984,26 @@ void gslc_DrawFrameQuad(gslc_tsGui* pGui,gslc_tsPt* psPt,gslc_tsColor nCol)
 // two filled triangles sharing one side. We have to be careful
 // about the triangle fill routine (ie. using rounding) so that
 // we can avoid leaving a thin seam between the two triangles.
+
+// Filled polygons are rasterized into spans by the core unless the
+// driver offers a native triangle fill but no span drawing
+#if (DRV_HAS_DRAW_SPANS) || !(DRV_HAS_DRAW_TRI_FILL)
+  #define GSLC_FILL_POLY_SPANS  1
+#else
+  #define GSLC_FILL_POLY_SPANS  0
+#endif
+
 void gslc_DrawFillQuad(gslc_tsGui* pGui,gslc_tsPt* psPt,gslc_tsColor nCol)
 {
+#if (GSLC_FILL_POLY_SPANS)
+  // Break down quadrilateral into two triangles that share
+  // the diagonal and submit the spans as a single batch
+  // - The diagonal is filled by the first triangle only
+  gslc_tsColorRaw nColRaw = gslc_DrvColorToRaw(pGui,nCol);
+  gslc_DrawFillTriangleSpans(pGui,psPt[0].x,psPt[0].y,psPt[1].x,psPt[1].y,psPt[2].x,psPt[2].y,false,nColRaw);
+  gslc_DrawFillTriangleSpans(pGui,psPt[2].x,psPt[2].y,psPt[0].x,psPt[0].y,psPt[3].x,psPt[3].y,true,nColRaw);
+  gslc_DrawSpanFlush(pGui);
+#else
   int16_t nX0,nY0,nX1,nY1,nX2,nY2;
 
   // Break down quadrilateral into two triangles
@@ -1771,22 +3016,128 @@ void gslc_DrawFillQuad(gslc_tsGui* pGui,gslc_tsPt* psPt,gslc_tsColor nCol)
   nX1 = psPt[0].x; nY1 = psPt[0].y;
   nX2 = psPt[3].x; nY2 = psPt[3].y;
   gslc_DrawFillTriangle(pGui,nX0,nY0,nX1,nY1,nX2,nY2,nCol);
+#endif // GSLC_FILL_POLY_SPANS
 
 }
 
-void gslc_DrawFillSectorBase(gslc_tsGui* pGui, int16_t nQuality, int16_t nMidX, int16_t nMidY, int16_t nRad1, int16_t nRad2,
-  gslc_tsColor cArcStart, gslc_tsColor cArcEnd,bool bGradient, int16_t nAngGradStart, int16_t nAngGradRange,int16_t nAngSecStart,int16_t nAngSecEnd)
+void gslc_RingGeomInit(gslc_tsRingGeom* pGeom,int16_t* anRowOuter,int16_t* anRowInner,uint16_t nRowMax,
+  gslc_tsPt* asRay,uint16_t nRayMax)
+{
+  if (pGeom == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "RingGeomInit";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  pGeom->bValid     = false;
+  pGeom->nQuality   = 0;
+  pGeom->nRad1      = 0;
+  pGeom->nRad2      = 0;
+  pGeom->nRowMax    = nRowMax;
+  pGeom->nRayMax    = nRayMax;
+  pGeom->nRayCnt    = 0;
+  pGeom->anRowOuter = anRowOuter;
+  pGeom->anRowInner = anRowInner;
+  pGeom->asRay      = asRay;
+}
+
+void gslc_RingGeomInvalidate(gslc_tsRingGeom* pGeom)
+{
+  if (pGeom == NULL) {
+    return;
+  }
+  pGeom->bValid = false;
+}
+
+bool gslc_RingGeomBuild(gslc_tsRingGeom* pGeom,int16_t nQuality,int16_t nRad1,int16_t nRad2)
+{
+  nRad1 = (nRad1 < 0)? 0 : nRad1;
+  if ((pGeom->bValid) && (pGeom->nQuality == nQuality) && (pGeom->nRad1 == nRad1) && (pGeom->nRad2 == nRad2)) {
+    return true;
+  }
+  pGeom->bValid = false;
+  if ((nQuality <= 0) || (nRad2 < 0) || (nRad1 > nRad2) || ((uint16_t)nRad2 >= pGeom->nRowMax)) {
+    // Ring can't be retained, so it is calculated on each draw
+    return false;
+  }
+
+  // Ring extents, from the outermost row inwards
+  int16_t nY;
+  int16_t nXOuter = 0;
+  int16_t nXInner = -1;
+  for (nY=nRad2;nY>=0;nY--) {
+    gslc_RingRowExtent(nRad1,nRad2,(int32_t)nY*nY,&nXOuter,&nXInner);
+    pGeom->anRowOuter[nY] = nXOuter;
+    pGeom->anRowInner[nY] = nXInner;
+  }
+
+  // Segment boundary directions
+  // - Calculated exactly as gslc_DrawFillArcSpans() would, so that
+  //   retained and calculated arcs still meet without seams
+  int16_t  nStep64 = 64 * (360 / nQuality);
+  int16_t  n64Ang;
+  uint16_t nRayInd;
+  pGeom->nRayCnt = ((uint16_t)nQuality < pGeom->nRayMax)? (uint16_t)nQuality : pGeom->nRayMax;
+  for (nRayInd=0;nRayInd<pGeom->nRayCnt;nRayInd++) {
+    n64Ang = (int16_t)(((int32_t)nRayInd * nStep64) % (360*64));
+    gslc_SinCosFX(n64Ang,&(pGeom->asRay[nRayInd].x),&(pGeom->asRay[nRayInd].y));
+    pGeom->asRay[nRayInd].y = -pGeom->asRay[nRayInd].y;
+  }
+
+  pGeom->nQuality = nQuality;
+  pGeom->nRad1    = nRad1;
+  pGeom->nRad2    = nRad2;
+  pGeom->bValid   = true;
+  return true;
+}
+
+// Look up the direction of a segment boundary in the retained geometry
+// - Returns false if the boundary isn't in the table
+bool gslc_RingGeomGetRay(gslc_tsRingGeom* pGeom,int16_t nSegInd,gslc_tsPt* psRay)
+{
+  if ((pGeom == NULL) || (!pGeom->bValid)) {
+    return false;
+  }
+  // Boundaries beyond a full circle repeat when the segments
+  // divide the circle evenly
+  if ((360 / pGeom->nQuality) * pGeom->nQuality == 360) {
+    nSegInd = nSegInd % pGeom->nQuality;
+    nSegInd = (nSegInd < 0)? nSegInd + pGeom->nQuality : nSegInd;
+  }
+  if ((nSegInd < 0) || ((uint16_t)nSegInd >= pGeom->nRayCnt)) {
+    return false;
+  }
+  *psRay = pGeom->asRay[nSegInd];
+  return true;
+}
+
+// Rasterize the arc covering nSegCnt segments from nSegFirst
+void gslc_DrawFillSectorArc(gslc_tsGui* pGui, int16_t nMidX, int16_t nMidY, int16_t nRad1, int16_t nRad2,
+  int16_t nStep64, int16_t nSegFirst, int16_t nSegCnt, gslc_tsRingGeom* pGeom, gslc_tsColorRaw nColRaw)
 {
-  gslc_tsPt anPts[4];
+  gslc_tsPt asRay[2];
+  gslc_tsPt* psRay = NULL;
+  if ((gslc_RingGeomGetRay(pGeom, nSegFirst, &asRay[0])) && (gslc_RingGeomGetRay(pGeom, nSegFirst+nSegCnt, &asRay[1]))) {
+    psRay = asRay;
+  }
+  gslc_DrawFillArcSpans(pGui, nMidX, nMidY, nRad1, nRad2, (int16_t)(((int32_t)nSegFirst * nStep64) % (360 * 64)),
+    (int32_t)nSegCnt * nStep64, psRay, (pGeom && pGeom->bValid)? pGeom : NULL, nColRaw);
+}
 
+void gslc_DrawFillSectorBase(gslc_tsGui* pGui, int16_t nQuality, int16_t nMidX, int16_t nMidY, int16_t nRad1, int16_t nRad2,
+  gslc_tsColor cArcStart, gslc_tsColor cArcEnd, bool bGradient, int16_t nAngGradStart, int16_t nAngGradRange,
+  int16_t nAngSecStart, int16_t nAngSecEnd, gslc_tsRingGeom* pGeom)
+{
   // Calculate degrees per step (based on quality setting)
+  // - The sector end points and gradient steps remain quantized to
+  //   segments so that adjoining sectors (eg. the active and inactive
+  //   regions of a ring gauge) meet on the same boundary. The arc
+  //   itself is rasterized exactly, independent of quality.
   int16_t nStepAng = 360 / nQuality;
   int16_t nStep64 = 64 * nStepAng;
 
-  int16_t nAng64;
-  int16_t nX, nY;
   int16_t nSegStart, nSegEnd;
   gslc_tsColor colSeg;
+  gslc_tsColorRaw nColSegRaw;
 
   nSegStart = nAngSecStart * (int32_t)nQuality / 360;
   nSegEnd = nAngSecEnd * (int32_t)nQuality / 360;
@@ -1796,69 +3147,77 @@ void gslc_DrawFillSectorBase(gslc_tsGui* pGui, int16_t nQuality, int16_t nMidX,
   nSegGradRange = nAngGradRange * (int32_t)nQuality / 360;
   nSegGradRange = (nSegGradRange == 0) ? 1 : nSegGradRange; // Guard against div/0
 
-  bool bClockwise;
+  // The drawing direction does not affect the result, so always
+  // rasterize clockwise from the lower segment
   int16_t nSegInd;
+  int16_t nSegMin;
   int16_t nStepCnt;
   if (nSegEnd >= nSegStart) {
     nStepCnt = nSegEnd - nSegStart;
-    bClockwise = true;
+    nSegMin = nSegStart;
   } else {
     nStepCnt = nSegStart - nSegEnd;
-    bClockwise = false;
+    nSegMin = nSegEnd;
   }
 
   #if defined(DBG_REDRAW)
-  //GSLC_DEBUG_PRINT("FillSector: AngSecStart=%d AngSecEnd=%d SegStart=%d SegEnd=%d StepCnt=%d CW=%d\n",
-  //  nAngSecStart,nAngSecEnd,nSegStart,nSegEnd,nStepCnt,bClockwise);
+  //GSLC_DEBUG_PRINT("FillSector: AngSecStart=%d AngSecEnd=%d SegStart=%d SegEnd=%d StepCnt=%d\n",
+  //  nAngSecStart,nAngSecEnd,nSegStart,nSegEnd,nStepCnt);
   #endif
 
-  for (int16_t nStepInd = 0; nStepInd < nStepCnt; nStepInd++) {
-    // Remap from the step to the segment index, depending on direction
-    nSegInd = (bClockwise)? (nSegStart + nStepInd) : (nSegStart - nStepInd - 1);
+  // Bring any retained geometry up to date
+  if (pGeom) {
+    gslc_RingGeomBuild(pGeom, nQuality, nRad1, nRad2);
+  }
+
+  if (!bGradient) {
+    // Flat coloring: a single arc
+    gslc_DrawFillSectorArc(pGui, nMidX, nMidY, nRad1, nRad2, nStep64, nSegMin, nStepCnt, pGeom,
+      gslc_DrvColorToRaw(pGui, cArcStart));
+    gslc_DrawSpanFlush(pGui);
+    return;
+  }
 
-    nAng64 = (int32_t)(nSegInd * nStep64) % (int32_t)(360 * 64);
-	
+  // Gradient coloring: one arc per run of segments that share a color
+  int16_t nRunStart = nSegMin;
+  int16_t nRunCnt = 0;
+  gslc_tsColorRaw nColRunRaw = 0;
+  for (int16_t nStepInd = 0; nStepInd < nStepCnt; nStepInd++) {
+    nSegInd = nSegMin + nStepInd;
+    int16_t nGradPos = 1000 * (int32_t)(nSegInd-nSegGradStart) / nSegGradRange;
     #if defined(DBG_REDRAW)
-    GSLC_DEBUG2_PRINT("FillSector:  StepInd=%d SegInd=%d (%d..%d) Ang64=%d\n", nStepInd, nSegInd, nSegStart, nSegEnd, nAng64);
+    GSLC_DEBUG2_PRINT("FillSector:  SegInd=%d (%d..%d) GradPos=%d\n", nSegInd, nSegStart, nSegEnd, nGradPos);
     #endif
-
-    gslc_PolarToXY(nRad1, nAng64, &nX, &nY);
-    anPts[0] = (gslc_tsPt) { nMidX + nX, nMidY + nY };
-    gslc_PolarToXY(nRad2, nAng64, &nX, &nY);
-    anPts[1] = (gslc_tsPt) { nMidX + nX, nMidY + nY };
-    gslc_PolarToXY(nRad2, nAng64 + nStep64, &nX, &nY);
-    anPts[2] = (gslc_tsPt) { nMidX + nX, nMidY + nY };
-    gslc_PolarToXY(nRad1, nAng64 + nStep64, &nX, &nY);
-    anPts[3] = (gslc_tsPt) { nMidX + nX, nMidY + nY };
-
-    if (bGradient) {
-      // Gradient coloring
-      int16_t nGradPos = 1000 * (int32_t)(nSegInd-nSegGradStart) / nSegGradRange;
-      #if defined(DBG_REDRAW)
-      GSLC_DEBUG2_PRINT("FillSector:   GradPos=%d\n", nGradPos);
-      #endif
-      colSeg = gslc_ColorBlend2(cArcStart, cArcEnd, 500, nGradPos);
-    } else {
-      // Flat coloring
-      colSeg = cArcStart;
+    colSeg = gslc_ColorBlend2(cArcStart, cArcEnd, 500, nGradPos);
+    nColSegRaw = gslc_DrvColorToRaw(pGui, colSeg);
+    if ((nRunCnt > 0) && (nColSegRaw != nColRunRaw)) {
+      gslc_DrawFillSectorArc(pGui, nMidX, nMidY, nRad1, nRad2, nStep64, nRunStart, nRunCnt, pGeom, nColRunRaw);
+      nRunCnt = 0;
     }
-    
-    gslc_DrawFillQuad(pGui, anPts, colSeg);
+    if (nRunCnt == 0) {
+      nRunStart = nSegInd;
+      nColRunRaw = nColSegRaw;
+    }
+    nRunCnt++;
+  }
+  if (nRunCnt > 0) {
+    gslc_DrawFillSectorArc(pGui, nMidX, nMidY, nRad1, nRad2, nStep64, nRunStart, nRunCnt, pGeom, nColRunRaw);
   }
+  gslc_DrawSpanFlush(pGui);
 }
 
 void gslc_DrawFillGradSector(gslc_tsGui* pGui, int16_t nQuality, int16_t nMidX, int16_t nMidY, int16_t nRad1, int16_t nRad2,
   gslc_tsColor cArcStart, gslc_tsColor cArcEnd, int16_t nAngSecStart, int16_t nAngSecEnd, int16_t nAngGradStart, int16_t nAngGradRange)
 {
   gslc_DrawFillSectorBase(pGui, nQuality, nMidX, nMidY, nRad1, nRad2, cArcStart, cArcEnd, true,
-    nAngGradStart, nAngGradRange, nAngSecStart, nAngSecEnd);
+    nAngGradStart, nAngGradRange, nAngSecStart, nAngSecEnd, NULL);
 }
 
 void gslc_DrawFillSector(gslc_tsGui* pGui, int16_t nQuality, int16_t nMidX, int16_t nMidY, int16_t nRad1, int16_t nRad2,
   gslc_tsColor cArc, int16_t nAngSecStart, int16_t nAngSecEnd)
 {
   gslc_DrawFillSectorBase(pGui, nQuality, nMidX, nMidY, nRad1, nRad2, cArc, cArc, false,
-    0, 0, nAngSecStart, nAngSecEnd);
+    0, 0, nAngSecStart, nAngSecEnd, NULL);
 }
 
 
@@ -1960,6 +3319,91 @@ bool gslc_FontSetMode(gslc_tsGui* pGui, int16_t nFontId, gslc_teFontRefMode eFon
 }
 
 
+// ------------------------------------------------------------------------
+// Style Functions
+// ------------------------------------------------------------------------
+
+bool gslc_StyleAdd(gslc_tsGui* pGui,int16_t nStyleId,gslc_tsColor colFrame,gslc_tsColor colFill,
+  gslc_tsColor colFrameGlow,gslc_tsColor colFillGlow,gslc_tsColor colTxt,gslc_tsColor colTxtGlow)
+{
+  #if (GSLC_STYLE_MAX > 0)
+  if (pGui->nStyleCnt+1 > GSLC_STYLE_MAX) {
+    GSLC_DEBUG2_PRINT("ERROR: StyleAdd(%s) added too many styles\n","");
+    return false;
+  }
+  if (gslc_StyleGet(pGui,nStyleId) != NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: StyleAdd() style already exists (ID=%d)\n",nStyleId);
+    return false;
+  }
+  gslc_tsStyle* pStyle = &(pGui->asStyle[pGui->nStyleCnt]);
+  pStyle->nId = nStyleId;
+  pGui->nStyleCnt++;
+  return gslc_StyleSet(pGui,nStyleId,colFrame,colFill,colFrameGlow,colFillGlow,colTxt,colTxtGlow);
+  #else
+  (void)pGui; // Unused
+  (void)nStyleId; // Unused
+  (void)colFrame; // Unused
+  (void)colFill; // Unused
+  (void)colFrameGlow; // Unused
+  (void)colFillGlow; // Unused
+  (void)colTxt; // Unused
+  (void)colTxtGlow; // Unused
+  GSLC_DEBUG2_PRINT("ERROR: StyleAdd(%s) requires GSLC_STYLE_MAX > 0\n","");
+  return false;
+  #endif
+}
+
+bool gslc_StyleSet(gslc_tsGui* pGui,int16_t nStyleId,gslc_tsColor colFrame,gslc_tsColor colFill,
+  gslc_tsColor colFrameGlow,gslc_tsColor colFillGlow,gslc_tsColor colTxt,gslc_tsColor colTxtGlow)
+{
+  gslc_tsStyle* pStyle = gslc_StyleGet(pGui,nStyleId);
+  if (pStyle == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: StyleSet() can't find style (ID=%d)\n",nStyleId);
+    (void)colFrame; // Unused
+    (void)colFill; // Unused
+    (void)colFrameGlow; // Unused
+    (void)colFillGlow; // Unused
+    (void)colTxt; // Unused
+    (void)colTxtGlow; // Unused
+    return false;
+  }
+  pStyle->colFrame      = colFrame;
+  pStyle->colFill       = colFill;
+  pStyle->colFrameGlow  = colFrameGlow;
+  pStyle->colFillGlow   = colFillGlow;
+  pStyle->colText       = colTxt;
+  pStyle->colTextGlow   = colTxtGlow;
+  #if (GSLC_FEATURE_COLOR_RAW)
+  pStyle->colFrameRaw     = gslc_DrvColorToRaw(pGui,colFrame);
+  pStyle->colFillRaw      = gslc_DrvColorToRaw(pGui,colFill);
+  pStyle->colFrameGlowRaw = gslc_DrvColorToRaw(pGui,colFrameGlow);
+  pStyle->colFillGlowRaw  = gslc_DrvColorToRaw(pGui,colFillGlow);
+  #endif
+
+  // The elements referencing the style are updated when they are
+  // drawn, so it is sufficient to redraw the page
+  gslc_InvalidateRgnScreen(pGui);
+  gslc_PageRedrawSet(pGui,true);
+  return true;
+}
+
+gslc_tsStyle* gslc_StyleGet(gslc_tsGui* pGui,int16_t nStyleId)
+{
+  #if (GSLC_STYLE_MAX > 0)
+  uint8_t  nStyleInd;
+  for (nStyleInd=0;nStyleInd<pGui->nStyleCnt;nStyleInd++) {
+    if (pGui->asStyle[nStyleInd].nId == nStyleId) {
+      return &(pGui->asStyle[nStyleInd]);
+    }
+  }
+  #else
+  (void)pGui; // Unused
+  (void)nStyleId; // Unused
+  #endif
+  return NULL;
+}
+
+
 // ------------------------------------------------------------------------
 // Page Functions
 // ------------------------------------------------------------------------
@@ -2020,6 +3464,22 @@ void gslc_PageAdd(gslc_tsGui* pGui,int16_t nPageId,gslc_tsElem* psElem,uint16_t
 
   // Initialize pPage->sCollect
   gslc_CollectReset(&pPage->sCollect,psElem,nMaxElem,psElemRef,nMaxElemRef);
+  #if (GSLC_REDRAW_IND_MAX > 0)
+  // Maintain a dirty index for the page's elements
+  pPage->sCollect.bRedrawIndEn = true;
+  #endif
+  #if (GSLC_TOUCH_IND_MAX > 0)
+  // Maintain a touch index for the page's elements
+  pPage->sTouchInd.bValid = false;
+  pPage->sTouchInd.bOvf   = false;
+  pPage->sCollect.pTouchInd = &pPage->sTouchInd;
+  #endif
+  #if (GSLC_ID_IND_MAX > 0)
+  // Maintain an ID index for the page's elements
+  pPage->sIdInd.bOvf = false;
+  pPage->sIdInd.nCnt = 0;
+  pPage->sCollect.pIdInd = &pPage->sIdInd;
+  #endif
 
   // Assign the requested Page ID
   pPage->nPageId = nPageId;
@@ -2156,8 +3616,9 @@ void gslc_PopupShow(gslc_tsGui* pGui, int16_t nPageId, bool bModal)
   else {
     // Modeless: activate other pages and enable background redraw
     // NOTE: If a popup overlaps controls that continue to be updated
-    //       in the background, then extra redraws will occur. In that
-    //       case, it may be preferrable to set redraw to false.
+    //       in the background, then the redraw pass only draws the
+    //       portions that are not covered by the popup's opaque
+    //       elements (see GSLC_FEATURE_OCCLUDE).
     gslc_SetStackState(pGui, GSLC_STACK_CUR, true, true);
     gslc_SetStackState(pGui, GSLC_STACK_BASE, true, true);
   }
@@ -2226,12 +3687,21 @@ bool gslc_PageRedrawGet(gslc_tsGui* pGui)
 // - The typical case for this being required is when an element
 //   requires redraw but it is marked as being transparent. Therefore,
 //   the lower level elements should be redrawn.
-// - For now, just mark the entire page as requiring redraw.
-// TODO: Determine which elements underneath should be redrawn based
-//       on the region exposed by the transparent element.
+// - The invalidated rect that contains the transparent element has
+//   its background marked as exposed, which forces a repaint of the
+//   background and all overlapping elements (back-to-front) within
+//   that rect.
+// - If partial redraw is not supported, or the element does not lie
+//   within an invalidated rect, then the entire page is marked as
+//   requiring redraw.
 void gslc_PageRedrawCalc(gslc_tsGui* pGui)
 {
   uint16_t          nInd;
+  uint16_t          nIndScan;
+  uint16_t          nIndMax;
+  bool              bUseRedrawInd;
+  uint8_t           nRectInd;
+  bool              bRectFound;
   int               nStackPage;
   gslc_tsElem*      pElem = NULL;
   gslc_tsElemRef*   pElemRef = NULL;
@@ -2240,6 +3710,16 @@ void gslc_PageRedrawCalc(gslc_tsGui* pGui)
   bool  bRedrawFullPage = false;  // Does entire page require redraw?
   gslc_tsPage*  pPage = NULL;
 
+  // If partial redraw is not supported, any exposed background
+  // requires the entire page to be redrawn
+  if ((!pGui->bRedrawPartialEn) && (pGui->bInvalidateEn)) {
+    for (nRectInd=0;nRectInd<pGui->nInvalidateRectCnt;nRectInd++) {
+      if (pGui->abInvalidateBkgnd[nRectInd]) {
+        bRedrawFullPage = true;
+      }
+    }
+  }
+
   // Work on each enabled page in the stack
   for (nStackPage=0;nStackPage<GSLC_STACK__MAX;nStackPage++) {
     // Select the page collection to process
@@ -2254,7 +3734,23 @@ void gslc_PageRedrawCalc(gslc_tsGui* pGui)
     }
     pCollect = &pPage->sCollect;
 
-    for (nInd=0;nInd<pCollect->nElemRefCnt;nInd++) {
+    // Only visit the elements in the collection's dirty index
+    // if available, otherwise scan the entire collection
+    bUseRedrawInd = gslc_CollectRedrawIndValid(pCollect);
+    #if (GSLC_REDRAW_IND_MAX > 0)
+    nIndMax = (bUseRedrawInd)? pCollect->nRedrawIndCnt : pCollect->nElemRefCnt;
+    #else
+    nIndMax = pCollect->nElemRefCnt;
+    (void)bUseRedrawInd; // Unused
+    #endif
+
+    for (nIndScan=0;nIndScan<nIndMax;nIndScan++) {
+      nInd = nIndScan;
+      #if (GSLC_REDRAW_IND_MAX > 0)
+      if (bUseRedrawInd) {
+        nInd = pCollect->anRedrawInd[nIndScan];
+      }
+      #endif
       pElemRef = &pCollect->asElemRef[nInd];
       gslc_teElemRefFlags eFlags = pElemRef->eElemFlags;
       pElem = gslc_GetElemFromRef(pGui,pElemRef);
@@ -2269,10 +3765,21 @@ void gslc_PageRedrawCalc(gslc_tsGui* pGui)
         // still warrant full page redraw.
         if (pGui->bRedrawPartialEn) {
           // Is the element transparent?
-          // FIXME: Instead of forcing full page redraw, consider
-          // using clipping region for partial redraw
           if (!(pElem->nFeatures & GSLC_ELEM_FEA_FILL_EN)) {
-            bRedrawFullPage = true;
+            // Force a redraw of all layers within the
+            // invalidated rect(s) that overlap the element
+            bRectFound = false;
+            if (pGui->bInvalidateEn) {
+              for (nRectInd=0;nRectInd<pGui->nInvalidateRectCnt;nRectInd++) {
+                if (gslc_IsRectOverlap(pGui->asInvalidateRect[nRectInd],pElem->rElem)) {
+                  pGui->abInvalidateBkgnd[nRectInd] = true;
+                  bRectFound = true;
+                }
+              }
+            }
+            if (!bRectFound) {
+              bRedrawFullPage = true;
+            }
           }
         } else {
           bRedrawFullPage = true;
@@ -2296,6 +3803,110 @@ void gslc_PageRedrawCalc(gslc_tsGui* pGui)
 
 }
 
+// Determine the portions of a rect on the page stack that aren't covered
+// by opaque elements on any higher layer of the stack
+uint8_t gslc_PageStackGetVisibleRects(gslc_tsGui* pGui,int8_t nStackPage,gslc_tsRect rRect,gslc_tsRect* asVis,uint8_t nVisMax)
+{
+  uint16_t          nInd;
+  uint8_t           nVisInd;
+  uint8_t           nVisCnt;
+  uint8_t           nPieceInd;
+  uint8_t           nPieceCnt;
+  gslc_tsRect       asPiece[4];
+  gslc_tsRect       rVis;
+  gslc_tsRect       rOcc;
+  int16_t           nVisX1,nVisY1,nOccX1,nOccY1,nMidY0,nMidY1;
+  int               nStackAbove;
+  gslc_tsPage*      pPage = NULL;
+  gslc_tsCollect*   pCollect = NULL;
+  gslc_tsElemRef*   pElemRef = NULL;
+  gslc_tsElem*      pElem = NULL;
+
+  if (nVisMax == 0) {
+    return 0;
+  }
+  asVis[0] = rRect;
+  nVisCnt = 1;
+
+  for (nStackAbove = nStackPage+1; nStackAbove < GSLC_STACK__MAX; nStackAbove++) {
+    pPage = pGui->apPageStack[nStackAbove];
+    if (!pPage) {
+      continue;
+    }
+    // Quick reject on the bounds of the page's elements
+    if (!gslc_IsRectOverlap(pPage->rBounds,rRect)) {
+      continue;
+    }
+    pCollect = &pPage->sCollect;
+    for (nInd = 0; nInd < pCollect->nElemRefCnt; nInd++) {
+      pElemRef = &(pCollect->asElemRef[nInd]);
+      if (!gslc_GetElemRefFlag(pGui,pElemRef,GSLC_ELEMREF_VISIBLE)) {
+        continue;
+      }
+      // Only consider elements that are known to paint their entire
+      // rect. Rounded elements leave their corners uncovered and custom
+      // drawn elements may not honor the fill.
+      pElem = gslc_GetElemFromRef(pGui,pElemRef);
+      if ((pElem == NULL) || (pElem->pfuncXDraw != NULL)) {
+        continue;
+      }
+      if (!(pElem->nFeatures & GSLC_ELEM_FEA_FILL_EN) || (pElem->nFeatures & GSLC_ELEM_FEA_ROUND_EN)) {
+        continue;
+      }
+      rOcc = pElem->rElem;
+      nOccX1 = rOcc.x + rOcc.w;
+      nOccY1 = rOcc.y + rOcc.h;
+
+      // Subtract the occluder from each of the visible rects
+      nVisInd = 0;
+      while (nVisInd < nVisCnt) {
+        rVis = asVis[nVisInd];
+        if (!gslc_IsRectOverlap(rOcc,rVis)) {
+          nVisInd++;
+          continue;
+        }
+        // Split the uncovered remainder into bands above and
+        // below the occluder and segments to its left and right
+        nVisX1 = rVis.x + rVis.w;
+        nVisY1 = rVis.y + rVis.h;
+        nMidY0 = (rOcc.y > rVis.y)? rOcc.y : rVis.y;
+        nMidY1 = (nOccY1 < nVisY1)? nOccY1 : nVisY1;
+        nPieceCnt = 0;
+        if (rOcc.y > rVis.y) {
+          asPiece[nPieceCnt++] = (gslc_tsRect) { rVis.x, rVis.y, rVis.w, (uint16_t)(rOcc.y - rVis.y) };
+        }
+        if (nOccY1 < nVisY1) {
+          asPiece[nPieceCnt++] = (gslc_tsRect) { rVis.x, nOccY1, rVis.w, (uint16_t)(nVisY1 - nOccY1) };
+        }
+        if (rOcc.x > rVis.x) {
+          asPiece[nPieceCnt++] = (gslc_tsRect) { rVis.x, nMidY0, (uint16_t)(rOcc.x - rVis.x), (uint16_t)(nMidY1 - nMidY0) };
+        }
+        if (nOccX1 < nVisX1) {
+          asPiece[nPieceCnt++] = (gslc_tsRect) { nOccX1, nMidY0, (uint16_t)(nVisX1 - nOccX1), (uint16_t)(nMidY1 - nMidY0) };
+        }
+        if (nVisCnt - 1 + nPieceCnt > nVisMax) {
+          // Too fragmented to track, so leave this rect uncut
+          nVisInd++;
+          continue;
+        }
+        // Replace the rect with its uncovered pieces. The pieces
+        // don't overlap the occluder so they are passed over by
+        // the remainder of the scan.
+        asVis[nVisInd] = asVis[--nVisCnt];
+        for (nPieceInd = 0; nPieceInd < nPieceCnt; nPieceInd++) {
+          asVis[nVisCnt++] = asPiece[nPieceInd];
+        }
+      }
+      if (nVisCnt == 0) {
+        // Fully covered
+        return 0;
+      }
+    } // nInd
+  } // nStackAbove
+
+  return nVisCnt;
+}
+
 // Redraw the active page
 // - If the page has been marked as needing redraw, then all
 //   elements are rendered
@@ -2313,84 +3924,127 @@ void gslc_PageRedrawGo(gslc_tsGui* pGui)
   // Determine final state of full-screen redraw
   bool  bPageRedraw = gslc_PageRedrawGet(pGui);
 
-  // Set the clipping based on the current invalidated region
-  if (pGui->bInvalidateEn) {
-    #if defined(DBG_REDRAW)
-    // Note that this will still outline the invalidation region
-    // even if we later discover that the changed element is on
-    // a page in the stack that has been disabled through
-    // abPageStackDoDraw[] = false.
-    GSLC_DEBUG_PRINT("DBG: PageRedrawGo() InvRgn: En=%d (%d,%u)-(%d,%d) PageRedraw=%d\n",
-      pGui->bInvalidateEn, pGui->rInvalidateRect.x, pGui->rInvalidateRect.y,
-      pGui->rInvalidateRect.x + pGui->rInvalidateRect.w - 1,
-      pGui->rInvalidateRect.y + pGui->rInvalidateRect.h - 1, bPageRedraw);
+  // Draw other elements (as needed, unless forced page redraw)
+  // TODO: Handle GSLC_EVTSUB_DRAW_NEEDED
+  uint32_t nSubType;
+  void*    pvData = NULL;
 
-    // Mark the invalidation region
-    gslc_DrvDrawFrameRect(pGui, pGui->rInvalidateRect, GSLC_COL_RED);
+  // Note that partial redraws only visit the elements in each
+  // page collection's dirty index (see gslc_CollectRedrawIndAdd)
+  // rather than scanning every element.
+
+  // Take a copy of the invalidated regions
+  // - Each invalidated rect is redrawn in a separate pass with the
+  //   clipping region set to the rect. Elements that don't overlap
+  //   the rect are skipped during the pass.
+  // - A copy is used since drawing may add to the invalidation region
+  // - If no invalidation region has been defined, a single pass is
+  //   performed with the clipping region set to the entire display
+  gslc_tsRect asRect[GSLC_INVALIDATE_RECT_MAX];
+  bool        abForce[GSLC_INVALIDATE_RECT_MAX];
+  uint8_t     nRectCnt = 0;
+  uint8_t     nPass;
+  bool        bPassForce;
+  if (pGui->bInvalidateEn) {
+    nRectCnt = pGui->nInvalidateRectCnt;
+    for (nPass = 0; nPass < nRectCnt; nPass++) {
+      asRect[nPass] = pGui->asInvalidateRect[nPass];
+      abForce[nPass] = pGui->abInvalidateBkgnd[nPass];
+    }
+  }
 
-    // Slow down rendering
-    delay(1000);
-    #endif // DBG_REDRAW
+  nPass = 0;
+  do {
+    // A forced pass redraws the background and all elements
+    // within the rect, eg. to refresh the layers that are
+    // exposed by a transparent, hidden or moved element.
+    bPassForce = bPageRedraw;
+
+    // Set the clipping based on the current invalidated region
+    if (nRectCnt > 0) {
+      bPassForce |= abForce[nPass];
+      #if defined(DBG_REDRAW)
+      // Note that this will still outline the invalidation region
+      // even if we later discover that the changed element is on
+      // a page in the stack that has been disabled through
+      // abPageStackDoDraw[] = false.
+      GSLC_DEBUG_PRINT("DBG: PageRedrawGo() InvRgn: Rect=%u/%u (%d,%u)-(%d,%d) PageRedraw=%d Force=%d\n",
+        nPass+1, nRectCnt, asRect[nPass].x, asRect[nPass].y,
+        asRect[nPass].x + asRect[nPass].w - 1,
+        asRect[nPass].y + asRect[nPass].h - 1, bPageRedraw, abForce[nPass]);
+
+      // Mark the invalidation region
+      gslc_DrvDrawFrameRect(pGui, asRect[nPass], GSLC_COL_RED);
+
+      // Slow down rendering
+      delay(1000);
+      #endif // DBG_REDRAW
+
+      pGui->bRedrawClipEn = true;
+      pGui->rRedrawClip = asRect[nPass];
+      gslc_SetClipRect(pGui, &(asRect[nPass]));
+    }
+    else {
+      // No invalidation region defined, so default the
+      // clipping region to the entire display
+      pGui->bRedrawClipEn = false;
+      gslc_SetClipRect(pGui, NULL);
+    }
 
-    gslc_SetClipRect(pGui, &(pGui->rInvalidateRect));
-  }
-  else {
-    // No invalidation region defined, so default the
-    // clipping region to the entire display
-    gslc_SetClipRect(pGui, NULL);
-  }
-
-  // If a full page redraw is required, then start by
-  // redrawing the background.
-  // NOTE:
-  // - It would be cleaner if we could treat the background
-  //   layer like any other element (and hence check for its
-  //   need-redraw status).
-  // - For now, assume background doesn't need update except
-  //   if the entire page is to be redrawn
-  //   TODO: Fix this assumption (either add specific flag
-  //         for bBkgndNeedRedraw or make the background just
-  //         another element).
-  if (bPageRedraw) {
-    gslc_DrvDrawBkgnd(pGui);
-    gslc_PageFlipSet(pGui,true);
-  }
+    // If a full page redraw is required, or the background
+    // within the invalidated rect has been exposed, then start
+    // by redrawing the background.
+    // - The background is only repainted within the current
+    //   clipping region. All elements overlapping the region
+    //   are then redrawn on top of it.
+    if (bPassForce) {
+      gslc_DrvDrawBkgnd(pGui);
+      gslc_PageFlipSet(pGui,true);
+    }
+    nSubType = (bPassForce)?GSLC_EVTSUB_DRAW_FORCE:GSLC_EVTSUB_DRAW_NEEDED;
+
+    // Issue page redraw events to all pages in stack
+    // - Start from bottom page in stack first
+    for (int nStackPage = 0; nStackPage < GSLC_STACK__MAX; nStackPage++) {
+      gslc_tsPage* pStackPage = pGui->apPageStack[nStackPage];
+      if (!pStackPage) {
+        continue;
+      }
+      if (!bPassForce && !pGui->abPageStackDoDraw[nStackPage]) {
+        // When doing a full page (or forced) redraw, proceed as normal
+        // When only doing a parital page redraw, check to see if
+        // the page has been marked as redraw-disabled. If so, skip
+        // updating the elements on the page.
+        //
+        // The redraw-disabled mode is useful to prevent "show-through"
+        // from dynamically-updating elements in lower layers of the
+        // page stack (this may occur with popup dialogs). If the overlay
+        // page does not overlap dynamically-updating elements, then
+        // DoDraw can be set to true, enabling background updates to occur.
+        continue;
+      }
+      // Record the layer being drawn so that elements covered by
+      // the layers above it can be culled
+      pGui->nRedrawStackPage = nStackPage;
+      pvData = (void*)(pStackPage);
+      gslc_tsEvent sEvent = gslc_EventCreate(pGui,GSLC_EVT_DRAW,nSubType,pvData,NULL);
+      gslc_PageEvent(pGui,sEvent);
+    }
+    pGui->nRedrawStackPage = GSLC_STACK__MAX;
 
-  // Draw other elements (as needed, unless forced page redraw)
-  // TODO: Handle GSLC_EVTSUB_DRAW_NEEDED
-  uint32_t nSubType = (bPageRedraw)?GSLC_EVTSUB_DRAW_FORCE:GSLC_EVTSUB_DRAW_NEEDED;
-  void*    pvData = NULL;
+    nPass++;
+  } while (nPass < nRectCnt);
 
-  // TODO: Consider creating a flag that indicates whether any elements
-  // on the page have requested redraw. This would enable us to skip
-  // over this exhaustive search every time we call Update()
+  pGui->bRedrawClipEn = false;
 
-  // Issue page redraw events to all pages in stack
-  // - Start from bottom page in stack first
+  // Remove the redrawn elements from the dirty index of each page
   for (int nStackPage = 0; nStackPage < GSLC_STACK__MAX; nStackPage++) {
     gslc_tsPage* pStackPage = pGui->apPageStack[nStackPage];
-    if (!pStackPage) {
-      continue;
-    }
-    if (!bPageRedraw && !pGui->abPageStackDoDraw[nStackPage]) {
-      // When doing a full page redraw, proceed as normal
-      // When only doing a parital page redraw, check to see if
-      // the page has been marked as redraw-disabled. If so, skip
-      // updating the elements on the page.
-      //
-      // The redraw-disabled mode is useful to prevent "show-through"
-      // from dynamically-updating elements in lower layers of the
-      // page stack (this may occur with popup dialogs). If the overlay
-      // page does not overlap dynamically-updating elements, then
-      // DoDraw can be set to true, enabling background updates to occur.
-      continue;
+    if (pStackPage) {
+      gslc_CollectRedrawIndUpdate(pGui,&(pStackPage->sCollect));
     }
-    pvData = (void*)(pStackPage);
-    gslc_tsEvent sEvent = gslc_EventCreate(pGui,GSLC_EVT_DRAW,nSubType,pvData,NULL);
-    gslc_PageEvent(pGui,sEvent);
   }
 
-
   // Clear the page redraw flag
   gslc_PageRedrawSet(pGui,false);
 
@@ -2403,9 +4057,7 @@ void gslc_PageRedrawGo(gslc_tsGui* pGui)
   // Clear the "need redraw" flag
   pGui->bRedrawNeeded = false;
 
-  // Page flip the entire screen
-  // - TODO: We could also call Update instead of Flip as that would
-  //         limit the region to refresh.
+  // Page flip the regions that have been redrawn
   gslc_PageFlipGo(pGui);
 
 }
@@ -2417,7 +4069,32 @@ void gslc_PageFlipSet(gslc_tsGui* pGui,bool bNeeded)
     return;
   }
 
-  pGui->bScreenNeedFlip = bNeeded;
+  if (!bNeeded) {
+    pGui->bScreenNeedFlip = false;
+    pGui->bScreenFlipRgnEn = false;
+    pGui->nFlipRectCnt = 0;
+  } else {
+    if (!pGui->bScreenNeedFlip) {
+      // Start tracking a new flip region
+      pGui->bScreenNeedFlip = true;
+      pGui->bScreenFlipRgnEn = true;
+      pGui->nFlipRectCnt = 0;
+    }
+    if (pGui->bScreenFlipRgnEn) {
+      if (!pGui->bRedrawClipEn) {
+        // Drawing isn't limited to a region, so flip the entire screen
+        pGui->bScreenFlipRgnEn = false;
+      } else if ((pGui->nFlipRectCnt == 0) ||
+        (memcmp(&(pGui->asFlipRect[pGui->nFlipRectCnt-1]),&(pGui->rRedrawClip),sizeof(gslc_tsRect)) != 0)) {
+        // Add the region of the current redraw pass
+        if (pGui->nFlipRectCnt < GSLC_INVALIDATE_RECT_MAX) {
+          pGui->asFlipRect[pGui->nFlipRectCnt++] = pGui->rRedrawClip;
+        } else {
+          pGui->bScreenFlipRgnEn = false;
+        }
+      }
+    }
+  }
 
   // To assist in debug of drawing primitives, support immediate
   // rendering of the current display. Note that this only works
@@ -2443,7 +4120,15 @@ void gslc_PageFlipGo(gslc_tsGui* pGui)
   }
 
   if (pGui->bScreenNeedFlip) {
+    #if (DRV_HAS_PAGE_FLIP_RECT)
+    if (pGui->bScreenFlipRgnEn) {
+      gslc_DrvPageFlipRect(pGui,pGui->asFlipRect,pGui->nFlipRectCnt);
+    } else {
+      gslc_DrvPageFlipNow(pGui);
+    }
+    #else
     gslc_DrvPageFlipNow(pGui);
+    #endif
 
     // Indicate that page flip is no longer required
     gslc_PageFlipSet(pGui,false);
@@ -2455,12 +4140,20 @@ gslc_tsPage* gslc_PageFindById(gslc_tsGui* pGui,int16_t nPageId)
 {
   int8_t nInd;
 
+  // Check the page that was found most recently, as repeated
+  // lookups usually target the same page
+  nInd = (int8_t)pGui->nPageIndLookup;
+  if ((nInd < pGui->nPageCnt) && (pGui->asPage[nInd].nPageId == nPageId)) {
+    return &pGui->asPage[nInd];
+  }
+
   // Loop through list of pages
   // Return pointer to page
   gslc_tsPage*  pFoundPage = NULL;
   for (nInd=0;nInd<pGui->nPageMax;nInd++) {
     if (pGui->asPage[nInd].nPageId == nPageId) {
       pFoundPage = &pGui->asPage[nInd];
+      pGui->nPageIndLookup = (uint8_t)nInd;
       break;
     }
   }
@@ -2476,6 +4169,21 @@ gslc_tsPage* gslc_PageFindById(gslc_tsGui* pGui,int16_t nPageId)
   return pFoundPage;
 }
 
+gslc_tsPage* gslc_PageFindByElemRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
+{
+  uint8_t         nPageInd;
+  gslc_tsCollect* pCollect = NULL;
+
+  // Locate the page collection that contains the element reference
+  for (nPageInd=0;nPageInd<pGui->nPageCnt;nPageInd++) {
+    pCollect = &(pGui->asPage[nPageInd].sCollect);
+    if ((pElemRef >= pCollect->asElemRef) && (pElemRef < pCollect->asElemRef + pCollect->nElemRefCnt)) {
+      return &(pGui->asPage[nPageInd]);
+    }
+  }
+  return NULL;
+}
+
 gslc_tsElemRef* gslc_PageFindElemById(gslc_tsGui* pGui,int16_t nPageId,int16_t nElemId)
 {
   gslc_tsPage*    pPage = NULL;
@@ -2492,6 +4200,18 @@ gslc_tsElemRef* gslc_PageFindElemById(gslc_tsGui* pGui,int16_t nPageId,int16_t n
   return pElemRef;
 }
 
+#if (GSLC_ELEM_COMPACT)
+bool gslc_PageSetElemAttr(gslc_tsGui* pGui,int16_t nPageId,gslc_tsElemAttr* asElemAttr,uint16_t nMaxElem)
+{
+  gslc_tsPage* pPage = gslc_PageFindById(pGui,nPageId);
+  if (pPage == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: PageSetElemAttr() can't find page (ID=%d)\n",nPageId);
+    return false;
+  }
+  return gslc_CollectSetElemAttr(&pPage->sCollect,asElemAttr,nMaxElem);
+}
+#endif // GSLC_ELEM_COMPACT
+
 /* UNUSED
 void gslc_PageSetEventFunc(gslc_tsGui* pGui,gslc_tsPage* pPage,GSLC_CB_EVENT funcCb)
 {
@@ -2568,10 +4288,12 @@ gslc_tsElem* gslc_GetElemFromRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
   // then cache it locally and return a pointer to the global
   // temporary element instead so that further accesses can
   // be direct.
+  // - On devices with memory-mapped FLASH (GSLC_PROGMEM_COPY=0)
+  //   the element is returned in place, as for SRC_CONST
   if ((eFlags & GSLC_ELEMREF_SRC) == GSLC_ELEMREF_SRC_PROG) {
     // TODO: Optimize by checking to see if we already cached this element
     // - Can probably do this by comparing the bValid and nId
-    #if (GSLC_USE_PROGMEM)
+    #if (GSLC_PROGMEM_COPY)
     memcpy_P(&pGui->sElemTmpProg,pElem,sizeof(gslc_tsElem));
     pElem = &pGui->sElemTmpProg;
     #endif
@@ -2664,14 +4386,14 @@ gslc_tsElemRef* gslc_ElemCreateTxt(gslc_tsGui* pGui,int16_t nElemId,int16_t nPag
   gslc_tsElem       sElem;
   gslc_tsElemRef*   pElemRef = NULL;
   sElem = gslc_ElemCreate(pGui,nElemId,nPage,GSLC_TYPE_TXT,rElem,pStrBuf,nStrBufMax,nFontId);
-  sElem.colElemFill       = GSLC_COL_BLACK;
-  sElem.colElemFillGlow   = GSLC_COL_BLACK;
-  sElem.colElemFrame      = GSLC_COL_GRAY;
-  sElem.colElemFrameGlow  = GSLC_COL_GRAY;
-  sElem.colElemText       = GSLC_COL_YELLOW;
-  sElem.colElemTextGlow   = GSLC_COL_YELLOW;
+  GSLC_ELEM_ATTR(&sElem)->colElemFill       = GSLC_COL_BLACK;
+  GSLC_ELEM_ATTR(&sElem)->colElemFillGlow   = GSLC_COL_BLACK;
+  GSLC_ELEM_ATTR(&sElem)->colElemFrame      = GSLC_COL_GRAY;
+  GSLC_ELEM_ATTR(&sElem)->colElemFrameGlow  = GSLC_COL_GRAY;
+  GSLC_ELEM_ATTR(&sElem)->colElemText       = GSLC_COL_YELLOW;
+  GSLC_ELEM_ATTR(&sElem)->colElemTextGlow   = GSLC_COL_YELLOW;
   sElem.nFeatures        |= GSLC_ELEM_FEA_FILL_EN;
-  sElem.eTxtAlign         = GSLC_ALIGN_MID_LEFT;
+  GSLC_ELEM_ATTR(&sElem)->eTxtAlign         = GSLC_ALIGN_MID_LEFT;
   if (nPage != GSLC_PAGE_NONE) {
     pElemRef = gslc_ElemAdd(pGui,nPage,&sElem,GSLC_ELEMREF_DEFAULT);
     return pElemRef;
@@ -2700,12 +4422,12 @@ gslc_tsElemRef* gslc_ElemCreateBtnTxt(gslc_tsGui* pGui,int16_t nElemId,int16_t n
   }
 
   sElem = gslc_ElemCreate(pGui,nElemId,nPage,GSLC_TYPE_BTN,rElem,pStrBuf,nStrBufMax,nFontId);
-  sElem.colElemFill       = GSLC_COL_BLUE_DK4;
-  sElem.colElemFillGlow   = GSLC_COL_BLUE_DK1;
-  sElem.colElemFrame      = GSLC_COL_BLUE_DK2;
-  sElem.colElemFrameGlow  = GSLC_COL_YELLOW;
-  sElem.colElemText       = GSLC_COL_WHITE;
-  sElem.colElemTextGlow   = GSLC_COL_WHITE;
+  GSLC_ELEM_ATTR(&sElem)->colElemFill       = GSLC_COL_BLUE_DK4;
+  GSLC_ELEM_ATTR(&sElem)->colElemFillGlow   = GSLC_COL_BLUE_DK1;
+  GSLC_ELEM_ATTR(&sElem)->colElemFrame      = GSLC_COL_BLUE_DK2;
+  GSLC_ELEM_ATTR(&sElem)->colElemFrameGlow  = GSLC_COL_YELLOW;
+  GSLC_ELEM_ATTR(&sElem)->colElemText       = GSLC_COL_WHITE;
+  GSLC_ELEM_ATTR(&sElem)->colElemTextGlow   = GSLC_COL_WHITE;
   sElem.nFeatures        |= GSLC_ELEM_FEA_FRAME_EN;
   sElem.nFeatures        |= GSLC_ELEM_FEA_FILL_EN;
   sElem.nFeatures        |= GSLC_ELEM_FEA_CLICK_EN;
@@ -2733,10 +4455,10 @@ gslc_tsElemRef* gslc_ElemCreateBtnImg(gslc_tsGui* pGui,int16_t nElemId,int16_t n
   gslc_tsElem     sElem;
   gslc_tsElemRef* pElemRef = NULL;
   sElem = gslc_ElemCreate(pGui,nElemId,nPage,GSLC_TYPE_BTN,rElem,NULL,0,GSLC_FONT_NONE);
-  sElem.colElemFill       = GSLC_COL_BLACK;
-  sElem.colElemFillGlow   = GSLC_COL_BLACK;
-  sElem.colElemFrame      = GSLC_COL_BLACK;
-  sElem.colElemFrameGlow  = GSLC_COL_YELLOW;
+  GSLC_ELEM_ATTR(&sElem)->colElemFill       = GSLC_COL_BLACK;
+  GSLC_ELEM_ATTR(&sElem)->colElemFillGlow   = GSLC_COL_BLACK;
+  GSLC_ELEM_ATTR(&sElem)->colElemFrame      = GSLC_COL_BLACK;
+  GSLC_ELEM_ATTR(&sElem)->colElemFrameGlow  = GSLC_COL_YELLOW;
   sElem.nFeatures        &= ~GSLC_ELEM_FEA_FRAME_EN;
   sElem.nFeatures        |= GSLC_ELEM_FEA_FILL_EN;
   sElem.nFeatures        |= GSLC_ELEM_FEA_CLICK_EN;
@@ -2768,10 +4490,10 @@ gslc_tsElemRef* gslc_ElemCreateBox(gslc_tsGui* pGui,int16_t nElemId,int16_t nPag
   gslc_tsElem     sElem;
   gslc_tsElemRef* pElemRef = NULL;
   sElem = gslc_ElemCreate(pGui,nElemId,nPage,GSLC_TYPE_BOX,rElem,NULL,0,GSLC_FONT_NONE);
-  sElem.colElemFill       = GSLC_COL_BLACK;
-  sElem.colElemFillGlow   = GSLC_COL_BLACK;
-  sElem.colElemFrame      = GSLC_COL_GRAY;
-  sElem.colElemFrameGlow  = GSLC_COL_GRAY;
+  GSLC_ELEM_ATTR(&sElem)->colElemFill       = GSLC_COL_BLACK;
+  GSLC_ELEM_ATTR(&sElem)->colElemFillGlow   = GSLC_COL_BLACK;
+  GSLC_ELEM_ATTR(&sElem)->colElemFrame      = GSLC_COL_GRAY;
+  GSLC_ELEM_ATTR(&sElem)->colElemFrameGlow  = GSLC_COL_GRAY;
   sElem.nFeatures        |= GSLC_ELEM_FEA_FILL_EN;
   sElem.nFeatures        |= GSLC_ELEM_FEA_FRAME_EN;
   if (nPage != GSLC_PAGE_NONE) {
@@ -2800,8 +4522,8 @@ gslc_tsElemRef* gslc_ElemCreateLine(gslc_tsGui* pGui,int16_t nElemId,int16_t nPa
   rRect.h = nY1 - nY0 + 1;
   sElem = gslc_ElemCreate(pGui,nElemId,nPage,GSLC_TYPE_LINE,rRect,NULL,0,GSLC_FONT_NONE);
   // For line elements, we will draw it with the "fill" color
-  sElem.colElemFill       = GSLC_COL_GRAY;
-  sElem.colElemFillGlow   = GSLC_COL_GRAY;
+  GSLC_ELEM_ATTR(&sElem)->colElemFill       = GSLC_COL_GRAY;
+  GSLC_ELEM_ATTR(&sElem)->colElemFillGlow   = GSLC_COL_GRAY;
   sElem.nFeatures        &= ~GSLC_ELEM_FEA_FILL_EN;   // Disable boundary box fill
   sElem.nFeatures        &= ~GSLC_ELEM_FEA_FRAME_EN;  // Disable boundary box frame
   if (nPage != GSLC_PAGE_NONE) {
@@ -2880,6 +4602,13 @@ bool gslc_ElemEvent(void* pvGui,gslc_tsEvent sEvent)
       pElemRef = (gslc_tsElemRef*)(pvScope);
       pElem = gslc_GetElemFromRefD(pGui, pElemRef, __LINE__);
 
+      // Skip elements that lie outside of the region being redrawn
+      // in the current pass. They will be handled in the pass
+      // for the invalidated rect that contains them.
+      if ((pGui->bRedrawClipEn) && (!gslc_IsRectOverlap(pElem->rElem,pGui->rRedrawClip))) {
+        return true;
+      }
+
       // Determine if redraw is needed
       gslc_teRedrawType eRedraw = gslc_ElemGetRedraw(pGui,pElemRef);
 
@@ -2887,16 +4616,56 @@ bool gslc_ElemEvent(void* pvGui,gslc_tsEvent sEvent)
         // Despite the current pending redraw state of the element,
         // we will force a full redraw as requested.
         //GSLC_DEBUG_PRINT("DBG: ElemEvent(Draw) nId=%d eRedraw=%d: force to FULL\n",pElem->nId,eRedraw);
-        return gslc_ElemDrawByRef(pGui,pElemRef,GSLC_REDRAW_FULL);
-      } else if (eRedraw != GSLC_REDRAW_NONE) {
-        // There is a pending redraw for the element. It may
-        // either be an incremental or full redraw.
-        //GSLC_DEBUG_PRINT("DBG: ElemEvent(Draw) nId=%d eRedraw=%d\n",pElem->nId,eRedraw);
-        return gslc_ElemDrawByRef(pGui,pElemRef,eRedraw);
-      } else {
+        eRedraw = GSLC_REDRAW_FULL;
+      } else if (eRedraw == GSLC_REDRAW_NONE) {
         // No redraw needed pending
         return true;
       }
+
+      #if (GSLC_FEATURE_OCCLUDE)
+      // Cull elements that are covered by opaque elements on a higher
+      // layer of the page stack. Elements within a compound element
+      // are left to the parent element.
+      if ((pGui->nRedrawStackPage < GSLC_STACK__MAX) && (pElem->pElemRefParent == NULL)) {
+        gslc_tsRect asVis[GSLC_OCCLUDE_RECT_MAX];
+        gslc_tsRect rElem = pElem->rElem;
+        uint8_t     nVisCnt;
+        uint8_t     nVisInd;
+        nVisCnt = gslc_PageStackGetVisibleRects(pGui,pGui->nRedrawStackPage,rElem,asVis,GSLC_OCCLUDE_RECT_MAX);
+        if (nVisCnt == 0) {
+          // The element is fully hidden, so drop the pending redraw.
+          // Removing the covering element will redraw the region.
+          gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_NONE);
+          return true;
+        }
+        if ((nVisCnt > 1) || (asVis[0].w != rElem.w) || (asVis[0].h != rElem.h)) {
+          // The element is partially hidden, so limit the drawing
+          // to the visible portions within the current pass
+          // - If the element is drawn in several pieces, each is a
+          //   full redraw as an incremental redraw may only render
+          //   its changes once.
+          if (nVisCnt > 1) {
+            eRedraw = GSLC_REDRAW_FULL;
+          }
+          bool bOk = true;
+          for (nVisInd = 0; nVisInd < nVisCnt; nVisInd++) {
+            if ((pGui->bRedrawClipEn) && (!gslc_ClipRect(&(pGui->rRedrawClip),&(asVis[nVisInd])))) {
+              // The visible portion lies outside of the current pass
+              continue;
+            }
+            gslc_SetClipRect(pGui,&(asVis[nVisInd]));
+            bOk &= gslc_ElemDrawByRef(pGui,pElemRef,eRedraw);
+          }
+          gslc_SetClipRect(pGui,(pGui->bRedrawClipEn)?&(pGui->rRedrawClip):NULL);
+          return bOk;
+        }
+      }
+      #endif // GSLC_FEATURE_OCCLUDE
+
+      // There is a pending redraw for the element. It may
+      // either be an incremental or full redraw.
+      //GSLC_DEBUG_PRINT("DBG: ElemEvent(Draw) nId=%d eRedraw=%d\n",pElem->nId,eRedraw);
+      return gslc_ElemDrawByRef(pGui,pElemRef,eRedraw);
       break;
 
     case GSLC_EVT_TOUCH:
@@ -3058,14 +4827,19 @@ void gslc_DrawTxtBase(gslc_tsGui* pGui, char* pStrBuf,gslc_tsRect rTxt,gslc_tsFo
     else if (eTxtAlign & GSLC_ALIGNV_BOT)      { nTxtY = nElemY+nElemH-nMarginH-nTxtSzH; }
     else                                       { nTxtY = nElemY+(nElemH/2)-(nTxtSzH/2); }
 
-    // Now correct for offset from text bounds
-    // - This is used by the driver (such as Adafruit-GFX) to provide an
-    //   adjustment for baseline height, etc.
-    nTxtX -= nTxtOffsetX;
-    nTxtY -= nTxtOffsetY;
-
-    // Call the driver text rendering routine
-    gslc_DrvDrawTxt(pGui,nTxtX,nTxtY,pTxtFont,pStrBuf,eTxtFlags,colTxt,colBg);
+    // Skip the text if it lies entirely outside the clipping region
+    bool bInside;
+    gslc_tsRect rTxtBound = (gslc_tsRect){nTxtX,nTxtY,nTxtSzW,nTxtSzH};
+    if (gslc_ClipBound(pGui,rTxtBound,&bInside)) {
+      // Now correct for offset from text bounds
+      // - This is used by the driver (such as Adafruit-GFX) to provide an
+      //   adjustment for baseline height, etc.
+      nTxtX -= nTxtOffsetX;
+      nTxtY -= nTxtOffsetY;
+
+      // Call the driver text rendering routine
+      gslc_DrvDrawTxt(pGui,nTxtX,nTxtY,pTxtFont,pStrBuf,eTxtFlags,colTxt,colBg);
+    }
 
 #endif // DRV_OVERRIDE_TXT_ALIGN
 
@@ -3090,6 +4864,11 @@ bool gslc_ElemDrawByRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRedrawT
 
   bool bOk = true;
 
+  #if (GSLC_STYLE_MAX > 0)
+  // Pick up the current colors of any shared style
+  gslc_ElemStyleApply(pGui,pElem);
+  #endif
+
   // --------------------------------------------------------------------------
   // Handle visibility
   // --------------------------------------------------------------------------
@@ -3174,7 +4953,7 @@ bool gslc_ElemDrawByRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRedrawT
     if (bRoundEn) {
       gslc_DrawFillRoundRect(pGui, sState.rInner, pGui->nRoundRadius, sState.colInner);
     } else {
-      gslc_DrawFillRect(pGui, sState.rInner, sState.colInner);
+      gslc_DrawFillRectRaw(pGui, sState.rInner, sState.colInnerRaw);
     }
   }
 
@@ -3183,7 +4962,7 @@ bool gslc_ElemDrawByRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRedrawT
   // Handle special element types
   // --------------------------------------------------------------------------
   if (pElem->nType == GSLC_TYPE_LINE) {
-    gslc_DrawLine(pGui,nElemX,nElemY,nElemX+nElemW-1,nElemY+nElemH-1,sState.colInner);
+    gslc_DrawLineRaw(pGui,nElemX,nElemY,nElemX+nElemW-1,nElemY+nElemH-1,sState.colInnerRaw);
   }
 
 
@@ -3192,13 +4971,13 @@ bool gslc_ElemDrawByRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRedrawT
   // --------------------------------------------------------------------------
 
   // Draw any images associated with element
-  if (pElem->sImgRefNorm.eImgFlags != GSLC_IMGREF_NONE) {
-    if ((bGlowing) && (pElem->sImgRefGlow.eImgFlags != GSLC_IMGREF_NONE)) {
-      bOk = gslc_DrvDrawImage(pGui,nElemX,nElemY,pElem->sImgRefGlow);
+  if (GSLC_ELEM_ATTR(pElem)->sImgRefNorm.eImgFlags != GSLC_IMGREF_NONE) {
+    if ((bGlowing) && (GSLC_ELEM_ATTR(pElem)->sImgRefGlow.eImgFlags != GSLC_IMGREF_NONE)) {
+      bOk = gslc_DrvDrawImage(pGui,nElemX,nElemY,GSLC_ELEM_ATTR(pElem)->sImgRefGlow);
     } else {
       // Note that when we are focused we are highlighting the frame
       // so we just draw the normal image.
-      bOk = gslc_DrvDrawImage(pGui,nElemX,nElemY,pElem->sImgRefNorm);
+      bOk = gslc_DrvDrawImage(pGui,nElemX,nElemY,GSLC_ELEM_ATTR(pElem)->sImgRefNorm);
     }
     if (!bOk) {
       GSLC_DEBUG2_PRINT("ERROR: DrvDrawImage failed\n","");
@@ -3219,7 +4998,7 @@ bool gslc_ElemDrawByRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRedrawT
     if (bRoundEn) {
       gslc_DrawFrameRoundRect(pGui, sState.rFull, pGui->nRoundRadius, sState.colFrm);
     } else {
-      gslc_DrawFrameRect(pGui, sState.rFull, sState.colFrm);
+      gslc_DrawFrameRectRaw(pGui, sState.rFull, sState.colFrmRaw);
     }
   }
   #endif
@@ -3229,14 +5008,14 @@ bool gslc_ElemDrawByRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRedrawT
   // --------------------------------------------------------------------------
 
   // Draw text string if defined
-  if (pElem->pStrBuf) {
-    int8_t        nMarginX  = pElem->nTxtMarginX;
-    int8_t        nMarginY  = pElem->nTxtMarginY;
+  if (GSLC_ELEM_ATTR(pElem)->pStrBuf) {
+    int8_t        nMarginX  = GSLC_ELEM_ATTR(pElem)->nTxtMarginX;
+    int8_t        nMarginY  = GSLC_ELEM_ATTR(pElem)->nTxtMarginY;
 
     // Note that we use the "inner" region for text placement to
     // avoid overlapping any frame
-    gslc_DrawTxtBase(pGui, pElem->pStrBuf, sState.rInner, pElem->pTxtFont, pElem->eTxtFlags,
-      pElem->eTxtAlign, sState.colTxtFore, sState.colTxtBack, nMarginX, nMarginY);
+    gslc_DrawTxtBase(pGui, GSLC_ELEM_ATTR(pElem)->pStrBuf, sState.rInner, GSLC_ELEM_ATTR(pElem)->pTxtFont, GSLC_ELEM_ATTR(pElem)->eTxtFlags,
+      GSLC_ELEM_ATTR(pElem)->eTxtAlign, sState.colTxtFore, sState.colTxtBack, nMarginX, nMarginY);
   }
 
   // --------------------------------------------------------------------------
@@ -3309,12 +5088,21 @@ void gslc_ElemSetCol(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsColor colF
   gslc_tsElem* pElem = gslc_GetElemFromRefD(pGui, pElemRef, __LINE__);
   if (!pElem) return;
 
-  if (!gslc_ColorEqual(pElem->colElemFrame, colFrame) ||
-      !gslc_ColorEqual(pElem->colElemFill, colFill) ||
-      !gslc_ColorEqual(pElem->colElemFillGlow, colFillGlow)) {
-    pElem->colElemFrame     = colFrame;
-    pElem->colElemFill      = colFill;
-    pElem->colElemFillGlow  = colFillGlow;
+  #if (GSLC_STYLE_MAX > 0)
+  // Colors that are set directly replace any shared style
+  if (pElem->nStyleInd != 0) {
+    gslc_ElemStyleApply(pGui,pElem);
+    pElem->nStyleInd = 0;
+  }
+  #endif
+
+  if (!gslc_ColorEqual(GSLC_ELEM_ATTR(pElem)->colElemFrame, colFrame) ||
+      !gslc_ColorEqual(GSLC_ELEM_ATTR(pElem)->colElemFill, colFill) ||
+      !gslc_ColorEqual(GSLC_ELEM_ATTR(pElem)->colElemFillGlow, colFillGlow)) {
+    GSLC_ELEM_ATTR(pElem)->colElemFrame     = colFrame;
+    GSLC_ELEM_ATTR(pElem)->colElemFill      = colFill;
+    GSLC_ELEM_ATTR(pElem)->colElemFillGlow  = colFillGlow;
+    gslc_ElemColRawUpdate(pGui,pElem);
     gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
   }
 }
@@ -3324,12 +5112,21 @@ void gslc_ElemSetGlowCol(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsColor
   gslc_tsElem* pElem = gslc_GetElemFromRefD(pGui, pElemRef, __LINE__);
   if (!pElem) return;
 
-  if (!gslc_ColorEqual(pElem->colElemFrameGlow, colFrameGlow) ||
-      !gslc_ColorEqual(pElem->colElemFillGlow, colFillGlow) ||
-      !gslc_ColorEqual(pElem->colElemTextGlow, colTxtGlow)) {
-    pElem->colElemFrameGlow   = colFrameGlow;
-    pElem->colElemFillGlow    = colFillGlow;
-    pElem->colElemTextGlow    = colTxtGlow;
+  #if (GSLC_STYLE_MAX > 0)
+  // Colors that are set directly replace any shared style
+  if (pElem->nStyleInd != 0) {
+    gslc_ElemStyleApply(pGui,pElem);
+    pElem->nStyleInd = 0;
+  }
+  #endif
+
+  if (!gslc_ColorEqual(GSLC_ELEM_ATTR(pElem)->colElemFrameGlow, colFrameGlow) ||
+      !gslc_ColorEqual(GSLC_ELEM_ATTR(pElem)->colElemFillGlow, colFillGlow) ||
+      !gslc_ColorEqual(GSLC_ELEM_ATTR(pElem)->colElemTextGlow, colTxtGlow)) {
+    GSLC_ELEM_ATTR(pElem)->colElemFrameGlow   = colFrameGlow;
+    GSLC_ELEM_ATTR(pElem)->colElemFillGlow    = colFillGlow;
+    GSLC_ELEM_ATTR(pElem)->colElemTextGlow    = colTxtGlow;
+    gslc_ElemColRawUpdate(pGui,pElem);
     gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
   }
 }
@@ -3356,16 +5153,17 @@ void gslc_ElemSetRect(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsRect rEle
   if (!pElem) return;
 
   // Invalidate region including both rects from before & after
-  gslc_InvalidateRgnAdd(pGui, pElem->rElem); // Old region
+  // - The old region exposes the background (and any elements
+  //   underneath) so it is redrawn in full
+  gslc_InvalidateRgnBkgnd(pGui, pElem->rElem); // Old region
   gslc_InvalidateRgnAdd(pGui, rElem); // New region
-  // Force a page redraw within the scope defined by the invalidation region
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
-  gslc_PageRedrawSet(pGui,true);
 
   // Update element
   pElem->rElem           = rElem;
 
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
+  gslc_CollectTouchIndInvalidate(pGui,pElemRef);
 }
 
 gslc_tsRect gslc_ElemGetRect(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
@@ -3382,7 +5180,7 @@ void gslc_ElemSetTxtAlign(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,unsigned nAl
   gslc_tsElem* pElem = gslc_GetElemFromRefD(pGui, pElemRef, __LINE__);
   if (!pElem) return;
 
-  pElem->eTxtAlign        = nAlign;
+  GSLC_ELEM_ATTR(pElem)->eTxtAlign        = nAlign;
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
 }
 
@@ -3391,8 +5189,8 @@ void gslc_ElemSetTxtMargin(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,unsigned nM
   gslc_tsElem* pElem = gslc_GetElemFromRefD(pGui, pElemRef, __LINE__);
   if (!pElem) return;
 
-  pElem->nTxtMarginX       = nMargin;
-  pElem->nTxtMarginY       = nMargin;
+  GSLC_ELEM_ATTR(pElem)->nTxtMarginX       = nMargin;
+  GSLC_ELEM_ATTR(pElem)->nTxtMarginY       = nMargin;
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
 }
 
@@ -3401,8 +5199,8 @@ void gslc_ElemSetTxtMarginXY(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,int8_t nM
   gslc_tsElem* pElem = gslc_GetElemFromRefD(pGui, pElemRef, __LINE__);
   if (!pElem) return;
 
-  pElem->nTxtMarginX       = nMarginX;
-  pElem->nTxtMarginY       = nMarginY;
+  GSLC_ELEM_ATTR(pElem)->nTxtMarginX       = nMarginX;
+  GSLC_ELEM_ATTR(pElem)->nTxtMarginY       = nMarginY;
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
 }
 
@@ -3430,7 +5228,7 @@ void gslc_ElemSetTxtStr(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,const char* pS
 
   // Check for read-only status (in case the string was
   // defined in Flash/PROGMEM)
-  if (pElem->nStrBufMax == 0) {
+  if (GSLC_ELEM_ATTR(pElem)->nStrBufMax == 0) {
     // String was read-only, so abort now
     return;
   }
@@ -3438,8 +5236,8 @@ void gslc_ElemSetTxtStr(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,const char* pS
   // To avoid unnecessary redraw / flicker, only a change in
   // the text content will drive a redraw
 
-  if (strncmp(pElem->pStrBuf,pStr,pElem->nStrBufMax)) {
-    gslc_StrCopy(pElem->pStrBuf,pStr,pElem->nStrBufMax);
+  if (strncmp(GSLC_ELEM_ATTR(pElem)->pStrBuf,pStr,GSLC_ELEM_ATTR(pElem)->nStrBufMax)) {
+    gslc_StrCopy(GSLC_ELEM_ATTR(pElem)->pStrBuf,pStr,GSLC_ELEM_ATTR(pElem)->nStrBufMax);
     gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_INC);
   }
 }
@@ -3448,7 +5246,7 @@ char* gslc_ElemGetTxtStr(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef)
 {
   gslc_tsElem* pElem = gslc_GetElemFromRefD(pGui, pElemRef, __LINE__);
   if (!pElem) return NULL;
-  return pElem->pStrBuf;
+  return GSLC_ELEM_ATTR(pElem)->pStrBuf;
 }
 
 void gslc_ElemSetTxtCol(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsColor colVal)
@@ -3456,10 +5254,18 @@ void gslc_ElemSetTxtCol(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsColor c
   gslc_tsElem* pElem = gslc_GetElemFromRefD(pGui, pElemRef, __LINE__);
   if (!pElem) return;
 
-  if (!gslc_ColorEqual(pElem->colElemText, colVal) ||
-      !gslc_ColorEqual(pElem->colElemTextGlow, colVal)) {
-    pElem->colElemText      = colVal;
-    pElem->colElemTextGlow  = colVal; // Default to same color for glowing state
+  #if (GSLC_STYLE_MAX > 0)
+  // Colors that are set directly replace any shared style
+  if (pElem->nStyleInd != 0) {
+    gslc_ElemStyleApply(pGui,pElem);
+    pElem->nStyleInd = 0;
+  }
+  #endif
+
+  if (!gslc_ColorEqual(GSLC_ELEM_ATTR(pElem)->colElemText, colVal) ||
+      !gslc_ColorEqual(GSLC_ELEM_ATTR(pElem)->colElemTextGlow, colVal)) {
+    GSLC_ELEM_ATTR(pElem)->colElemText      = colVal;
+    GSLC_ELEM_ATTR(pElem)->colElemTextGlow  = colVal; // Default to same color for glowing state
     // TODO: Might want to change to GSLC_REDRAW_INC
     gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
   }
@@ -3479,8 +5285,8 @@ void gslc_ElemSetTxtMem(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teTxtFlag
       return;
     }
   }
-  gslc_teTxtFlags eFlagsCur = pElem->eTxtFlags;
-  pElem->eTxtFlags = (eFlagsCur & ~GSLC_TXT_MEM) | (eFlags & GSLC_TXT_MEM);
+  gslc_teTxtFlags eFlagsCur = GSLC_ELEM_ATTR(pElem)->eTxtFlags;
+  GSLC_ELEM_ATTR(pElem)->eTxtFlags = (eFlagsCur & ~GSLC_TXT_MEM) | (eFlags & GSLC_TXT_MEM);
 }
 
 void gslc_ElemSetTxtEnc(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teTxtFlags eFlags)
@@ -3488,8 +5294,8 @@ void gslc_ElemSetTxtEnc(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teTxtFlag
   gslc_tsElem* pElem = gslc_GetElemFromRefD(pGui, pElemRef, __LINE__);
   if (!pElem) return;
 
-  gslc_teTxtFlags eFlagsCur = pElem->eTxtFlags;
-  pElem->eTxtFlags = (eFlagsCur & ~GSLC_TXT_ENC) | (eFlags & GSLC_TXT_ENC);
+  gslc_teTxtFlags eFlagsCur = GSLC_ELEM_ATTR(pElem)->eTxtFlags;
+  GSLC_ELEM_ATTR(pElem)->eTxtFlags = (eFlagsCur & ~GSLC_TXT_ENC) | (eFlags & GSLC_TXT_ENC);
 }
 
 void gslc_ElemUpdateFont(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,int nFontId)
@@ -3497,7 +5303,7 @@ void gslc_ElemUpdateFont(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,int nFontId)
   gslc_tsElem* pElem = gslc_GetElemFromRefD(pGui, pElemRef, __LINE__);
   if (!pElem) return;
 
-  pElem->pTxtFont = gslc_FontGet(pGui,nFontId);
+  GSLC_ELEM_ATTR(pElem)->pTxtFont = gslc_FontGet(pGui,nFontId);
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
 }
 
@@ -3561,6 +5367,9 @@ void gslc_ElemSetRedraw(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRedrawT
     if (gslc_ElemGetOnScreen(pGui,pElemRef)) {
       gslc_InvalidateRgnAdd(pGui, pElem->rElem);
     }
+
+    // Record the element in its collection's dirty index
+    gslc_CollectRedrawIndAdd(pGui,pElemRef);
   }
 
   // Update the redraw state
@@ -3750,13 +5559,12 @@ void gslc_ElemSetVisible(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,bool bVisible
   // Mark the element as needing redraw if its visibility status changed
   if (bVisible != bVisibleOld) {
     gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
+    gslc_CollectTouchIndInvalidate(pGui,pElemRef);
     if (bVisible == false) {
       // Since we are hiding an element, we need to invalidate
-      // the region underneath the element, so that it can
-      // be redrawn.
-      gslc_InvalidateRgnAdd(pGui, pElem->rElem);
-      // Mark the page as having a redraw pending
-      gslc_PageRedrawSet(pGui,true);
+      // the region underneath the element (including the
+      // background), so that it can be redrawn.
+      gslc_InvalidateRgnBkgnd(pGui, pElem->rElem);
      }
   }
 
@@ -3869,6 +5677,7 @@ void gslc_ElemSetClickEn(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,bool bClickEn
   } else {
     pElem->nFeatures &= ~GSLC_ELEM_FEA_CLICK_EN;
   }
+  gslc_CollectTouchIndInvalidate(pGui,pElemRef);
 
   #if (GSLC_FEATURE_INPUT)
   // For now, associate accepting click events as also accepting focus
@@ -3902,13 +5711,13 @@ void gslc_ElemSetStyleFrom(gslc_tsGui* pGui,gslc_tsElemRef* pElemRefSrc,gslc_tsE
   // rElem
   pElemDest->nGroup           = pElemSrc->nGroup;
   pElemDest->nFeatures        = pElemSrc->nFeatures;
-  pElemDest->sImgRefNorm      = pElemSrc->sImgRefNorm;
-  pElemDest->sImgRefGlow      = pElemSrc->sImgRefGlow;
+  GSLC_ELEM_ATTR(pElemDest)->sImgRefNorm      = GSLC_ELEM_ATTR(pElemSrc)->sImgRefNorm;
+  GSLC_ELEM_ATTR(pElemDest)->sImgRefGlow      = GSLC_ELEM_ATTR(pElemSrc)->sImgRefGlow;
 
-  pElemDest->colElemFill      = pElemSrc->colElemFill;
-  pElemDest->colElemFillGlow  = pElemSrc->colElemFillGlow;
-  pElemDest->colElemFrame     = pElemSrc->colElemFrame;
-  pElemDest->colElemFrameGlow = pElemSrc->colElemFrameGlow;
+  GSLC_ELEM_ATTR(pElemDest)->colElemFill      = GSLC_ELEM_ATTR(pElemSrc)->colElemFill;
+  GSLC_ELEM_ATTR(pElemDest)->colElemFillGlow  = GSLC_ELEM_ATTR(pElemSrc)->colElemFillGlow;
+  GSLC_ELEM_ATTR(pElemDest)->colElemFrame     = GSLC_ELEM_ATTR(pElemSrc)->colElemFrame;
+  GSLC_ELEM_ATTR(pElemDest)->colElemFrameGlow = GSLC_ELEM_ATTR(pElemSrc)->colElemFrameGlow;
 
   // eRedraw
 #if (GSLC_FEATURE_COMPOUND)
@@ -3921,12 +5730,20 @@ void gslc_ElemSetStyleFrom(gslc_tsGui* pGui,gslc_tsElemRef* pElemRefSrc,gslc_tsE
   //  nStrMax
   //  eTxtFlags
 
-  pElemDest->colElemText      = pElemSrc->colElemText;
-  pElemDest->colElemTextGlow  = pElemSrc->colElemTextGlow;
-  pElemDest->eTxtAlign        = pElemSrc->eTxtAlign;
-  pElemDest->nTxtMarginX      = pElemSrc->nTxtMarginX;
-  pElemDest->nTxtMarginY      = pElemSrc->nTxtMarginY;
-  pElemDest->pTxtFont         = pElemSrc->pTxtFont;
+  GSLC_ELEM_ATTR(pElemDest)->colElemText      = GSLC_ELEM_ATTR(pElemSrc)->colElemText;
+  GSLC_ELEM_ATTR(pElemDest)->colElemTextGlow  = GSLC_ELEM_ATTR(pElemSrc)->colElemTextGlow;
+#if (GSLC_STYLE_MAX > 0)
+  pElemDest->nStyleInd        = pElemSrc->nStyleInd;
+#endif
+  if ((pElemRefDest->eElemFlags & GSLC_ELEMREF_SRC) == GSLC_ELEMREF_SRC_RAM) {
+    gslc_ElemColRawUpdate(pGui,pElemDest);
+  } else {
+    pElemDest->nFeatures &= ~GSLC_ELEM_FEA_COLRAW;
+  }
+  GSLC_ELEM_ATTR(pElemDest)->eTxtAlign        = GSLC_ELEM_ATTR(pElemSrc)->eTxtAlign;
+  GSLC_ELEM_ATTR(pElemDest)->nTxtMarginX      = GSLC_ELEM_ATTR(pElemSrc)->nTxtMarginX;
+  GSLC_ELEM_ATTR(pElemDest)->nTxtMarginY      = GSLC_ELEM_ATTR(pElemSrc)->nTxtMarginY;
+  GSLC_ELEM_ATTR(pElemDest)->pTxtFont         = GSLC_ELEM_ATTR(pElemSrc)->pTxtFont;
 
   // pXData
 
@@ -3935,9 +5752,84 @@ void gslc_ElemSetStyleFrom(gslc_tsGui* pGui,gslc_tsElemRef* pElemRefSrc,gslc_tsE
   pElemDest->pfuncXTouch      = pElemSrc->pfuncXTouch;
   pElemDest->pfuncXTick       = pElemSrc->pfuncXTick;
 
+  // Register the element to receive ticks
+  gslc_TickSubSet(pGui,pElemRefDest,(pElemDest->pfuncXTick != NULL),false,0);
+
   gslc_ElemSetRedraw(pGui,pElemRefDest,GSLC_REDRAW_FULL);
 }
 
+bool gslc_ElemSetStyle(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,int16_t nStyleId)
+{
+  gslc_tsElem* pElem = gslc_GetElemFromRefD(pGui, pElemRef, __LINE__);
+  if (!pElem) return false;
+
+  #if (GSLC_STYLE_MAX > 0)
+  if ((pElemRef->eElemFlags & GSLC_ELEMREF_SRC) != GSLC_ELEMREF_SRC_RAM) {
+    GSLC_DEBUG2_PRINT("ERROR: ElemSetStyle(ID=%d) element must be in RAM\n",pElem->nId);
+    return false;
+  }
+  uint8_t nStyleInd = 0;
+  if (nStyleId != GSLC_STYLE_NONE) {
+    gslc_tsStyle* pStyle = gslc_StyleGet(pGui,nStyleId);
+    if (pStyle == NULL) {
+      GSLC_DEBUG2_PRINT("ERROR: ElemSetStyle() can't find style (ID=%d)\n",nStyleId);
+      return false;
+    }
+    nStyleInd = (uint8_t)(pStyle - pGui->asStyle) + 1;
+  }
+  if (pElem->nStyleInd != nStyleInd) {
+    pElem->nStyleInd = nStyleInd;
+    gslc_ElemStyleApply(pGui,pElem);
+    gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
+  }
+  return true;
+  #else
+  (void)nStyleId; // Unused
+  GSLC_DEBUG2_PRINT("ERROR: ElemSetStyle(%s) requires GSLC_STYLE_MAX > 0\n","");
+  return false;
+  #endif
+}
+
+void gslc_ElemStyleApply(gslc_tsGui* pGui,gslc_tsElem* pElem)
+{
+  #if (GSLC_STYLE_MAX > 0)
+  if (pElem->nStyleInd == 0) {
+    return;
+  }
+  gslc_tsStyle* pStyle = &(pGui->asStyle[pElem->nStyleInd-1]);
+  GSLC_ELEM_ATTR(pElem)->colElemFrame     = pStyle->colFrame;
+  GSLC_ELEM_ATTR(pElem)->colElemFill      = pStyle->colFill;
+  GSLC_ELEM_ATTR(pElem)->colElemFrameGlow = pStyle->colFrameGlow;
+  GSLC_ELEM_ATTR(pElem)->colElemFillGlow  = pStyle->colFillGlow;
+  GSLC_ELEM_ATTR(pElem)->colElemText      = pStyle->colText;
+  GSLC_ELEM_ATTR(pElem)->colElemTextGlow  = pStyle->colTextGlow;
+  #if (GSLC_FEATURE_COLOR_RAW)
+  GSLC_ELEM_ATTR(pElem)->colElemFrameRaw     = pStyle->colFrameRaw;
+  GSLC_ELEM_ATTR(pElem)->colElemFillRaw      = pStyle->colFillRaw;
+  GSLC_ELEM_ATTR(pElem)->colElemFrameGlowRaw = pStyle->colFrameGlowRaw;
+  GSLC_ELEM_ATTR(pElem)->colElemFillGlowRaw  = pStyle->colFillGlowRaw;
+  pElem->nFeatures |= GSLC_ELEM_FEA_COLRAW;
+  #endif
+  #else
+  (void)pGui; // Unused
+  (void)pElem; // Unused
+  #endif
+}
+
+void gslc_ElemColRawUpdate(gslc_tsGui* pGui,gslc_tsElem* pElem)
+{
+  #if (GSLC_FEATURE_COLOR_RAW)
+  GSLC_ELEM_ATTR(pElem)->colElemFrameRaw     = gslc_DrvColorToRaw(pGui,GSLC_ELEM_ATTR(pElem)->colElemFrame);
+  GSLC_ELEM_ATTR(pElem)->colElemFillRaw      = gslc_DrvColorToRaw(pGui,GSLC_ELEM_ATTR(pElem)->colElemFill);
+  GSLC_ELEM_ATTR(pElem)->colElemFrameGlowRaw = gslc_DrvColorToRaw(pGui,GSLC_ELEM_ATTR(pElem)->colElemFrameGlow);
+  GSLC_ELEM_ATTR(pElem)->colElemFillGlowRaw  = gslc_DrvColorToRaw(pGui,GSLC_ELEM_ATTR(pElem)->colElemFillGlow);
+  pElem->nFeatures |= GSLC_ELEM_FEA_COLRAW;
+  #else
+  (void)pGui; // Unused
+  (void)pElem; // Unused
+  #endif
+}
+
 // Calculate the expansion required for the element
 // rect to allow for focus and/or frame modes.
 //
@@ -4010,6 +5902,8 @@ void gslc_ResetRectState(gslc_tsRectState *pState)
   pState->colBack = GSLC_COL_BLACK;
   pState->colTxtFore = GSLC_COL_WHITE;
   pState->colTxtBack = GSLC_COL_BLACK;
+  pState->colFrmRaw = 0;
+  pState->colInnerRaw = 0;
 };
 
 void gslc_ElemCalcRectState(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef, gslc_tsRectState* pState)
@@ -4063,15 +5957,33 @@ void gslc_ElemCalcRectState(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef, gslc_tsR
   #endif // GSLC_FEATURE_INPUT
 
   // Calculate the element colors
-  pState->colBack = pElem->colElemFill;
+  pState->colBack = GSLC_ELEM_ATTR(pElem)->colElemFill;
   if (bGlowing) {
-    pState->colFrm = pElem->colElemFrameGlow;
-    pState->colInner = pElem->colElemFillGlow;
-    pState->colTxtFore = pElem->colElemTextGlow;
+    pState->colFrm = GSLC_ELEM_ATTR(pElem)->colElemFrameGlow;
+    pState->colInner = GSLC_ELEM_ATTR(pElem)->colElemFillGlow;
+    pState->colTxtFore = GSLC_ELEM_ATTR(pElem)->colElemTextGlow;
   } else {
-    pState->colFrm = pElem->colElemFrame;
-    pState->colInner = pElem->colElemFill;
-    pState->colTxtFore = pElem->colElemText;
+    pState->colFrm = GSLC_ELEM_ATTR(pElem)->colElemFrame;
+    pState->colInner = GSLC_ELEM_ATTR(pElem)->colElemFill;
+    pState->colTxtFore = GSLC_ELEM_ATTR(pElem)->colElemText;
+  }
+
+  // Fetch the native element colors, converting them only if
+  // the element doesn't hold them (eg. stored in FLASH)
+  #if (GSLC_FEATURE_COLOR_RAW)
+  if (pElem->nFeatures & GSLC_ELEM_FEA_COLRAW) {
+    if (bGlowing) {
+      pState->colFrmRaw = GSLC_ELEM_ATTR(pElem)->colElemFrameGlowRaw;
+      pState->colInnerRaw = GSLC_ELEM_ATTR(pElem)->colElemFillGlowRaw;
+    } else {
+      pState->colFrmRaw = GSLC_ELEM_ATTR(pElem)->colElemFrameRaw;
+      pState->colInnerRaw = GSLC_ELEM_ATTR(pElem)->colElemFillRaw;
+    }
+  } else
+  #endif
+  {
+    pState->colFrmRaw = gslc_DrvColorToRaw(pGui,pState->colFrm);
+    pState->colInnerRaw = gslc_DrvColorToRaw(pGui,pState->colInner);
   }
 
   // Calculate text background color
@@ -4112,6 +6024,19 @@ void gslc_ElemSetTickFunc(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,GSLC_CB_TICK
   if (!pElem) return;
 
   pElem->pfuncXTick       = funcCb;
+
+  // Register the element to receive ticks
+  gslc_TickSubSet(pGui,pElemRef,(funcCb != NULL),false,0);
+}
+
+void gslc_ElemSetTickPeriod(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,uint16_t nPeriodMs)
+{
+  if (pElemRef == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemSetTickPeriod";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  gslc_TickSubSet(pGui,pElemRef,true,true,nPeriodMs);
 }
 
 bool gslc_ElemOwnsCoord(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,int16_t nX,int16_t nY,bool bOnlyClickEn)
@@ -5163,6 +7088,10 @@ gslc_tsElem gslc_ElemCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t nPageId,
   int16_t nType,gslc_tsRect rElem,char* pStrBuf,uint8_t nStrBufMax,int16_t nFontId)
 {
   gslc_tsElem sElem;
+#if (GSLC_ELEM_COMPACT)
+  // Use the temporary attribute record until the destination is known
+  sElem.pAttr = (pGui == NULL) ? NULL : &(pGui->sElemAttrTmp);
+#endif
   // Assign defaults to the element record
   gslc_ResetElem(&sElem);
 
@@ -5215,12 +7144,22 @@ gslc_tsElem gslc_ElemCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t nPageId,
     }
   }
 
+#if (GSLC_ELEM_COMPACT)
+  // Stage the attributes in the page slot that CollectElemAdd() will
+  // use, so that any temporary elements created before the element is
+  // added (eg. the sub-elements of a compound element) don't share it
+  if ((pCollect != NULL) && (pCollect->asElemAttr != NULL) && (pCollect->nElemCnt < pCollect->nElemMax)) {
+    sElem.pAttr = &(pCollect->asElemAttr[pCollect->nElemCnt]);
+    gslc_ResetElem(&sElem);
+  }
+#endif
+
 
   // Override defaults with parameterization
   sElem.nId             = nElemId;
   sElem.rElem           = rElem;
   sElem.nType           = nType;
-  sElem.pTxtFont        = gslc_FontGet(pGui,nFontId);
+  GSLC_ELEM_ATTR(&sElem)->pTxtFont        = gslc_FontGet(pGui,nFontId);
 
   // Initialize the local string buffer (if enabled via GSLC_LOCAL_STR)
   // otherwise just save a copy of the external string buffer pointer
@@ -5236,8 +7175,8 @@ gslc_tsElem gslc_ElemCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t nPageId,
   //       flash.
   if (pStrBuf == NULL) {
     // No string enabled, so set the flag accordingly
-    sElem.nStrBufMax = 0;
-    sElem.eTxtFlags  = (sElem.eTxtFlags & ~GSLC_TXT_ALLOC) | GSLC_TXT_ALLOC_NONE;
+    GSLC_ELEM_ATTR(&sElem)->nStrBufMax = 0;
+    GSLC_ELEM_ATTR(&sElem)->eTxtFlags  = (GSLC_ELEM_ATTR(&sElem)->eTxtFlags & ~GSLC_TXT_ALLOC) | GSLC_TXT_ALLOC_NONE;
   } else {
     #if (GSLC_LOCAL_STR)
       // NOTE: Assume the string buffer pointer is located in RAM and not PROGMEM
@@ -5250,15 +7189,15 @@ gslc_tsElem gslc_ElemCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t nPageId,
       } else {
         nBufMax = GSLC_MIN(GSLC_LOCAL_STR_LEN,nStrBufMax);
       }
-      gslc_StrCopy(sElem.pStrBuf,pStrBuf,nBufMax);
-      sElem.nStrBufMax = nBufMax;
-      sElem.eTxtFlags  = (sElem.eTxtFlags & ~GSLC_TXT_ALLOC) | GSLC_TXT_ALLOC_INT;
+      gslc_StrCopy(GSLC_ELEM_ATTR(&sElem)->pStrBuf,pStrBuf,nBufMax);
+      GSLC_ELEM_ATTR(&sElem)->nStrBufMax = nBufMax;
+      GSLC_ELEM_ATTR(&sElem)->eTxtFlags  = (GSLC_ELEM_ATTR(&sElem)->eTxtFlags & ~GSLC_TXT_ALLOC) | GSLC_TXT_ALLOC_INT;
     #else
       // No need to copy locally; instead, we are going to retain
       // the external string pointer (must be static)
-      sElem.pStrBuf    = pStrBuf;
-      sElem.nStrBufMax = nStrBufMax;
-      sElem.eTxtFlags  = (sElem.eTxtFlags & ~GSLC_TXT_ALLOC) | GSLC_TXT_ALLOC_EXT;
+      GSLC_ELEM_ATTR(&sElem)->pStrBuf    = pStrBuf;
+      GSLC_ELEM_ATTR(&sElem)->nStrBufMax = nStrBufMax;
+      GSLC_ELEM_ATTR(&sElem)->eTxtFlags  = (GSLC_ELEM_ATTR(&sElem)->eTxtFlags & ~GSLC_TXT_ALLOC) | GSLC_TXT_ALLOC_EXT;
     #endif
   }
 
@@ -5319,6 +7258,26 @@ bool gslc_CollectEvent(void* pvGui,gslc_tsEvent sEvent)
     return true;
     #endif  // !DRV_TOUCH_NONE
 
+  } else if ( (sEvent.eType == GSLC_EVT_DRAW) && (sEvent.nSubType == GSLC_EVTSUB_DRAW_NEEDED) &&
+    (gslc_CollectRedrawIndValid(pCollect)) ) {
+    #if (GSLC_REDRAW_IND_MAX > 0)
+    // DRAW (if needed) is only propagated down to the elements in the
+    // collection's dirty index
+    // - A copy of the index is used as elements may request
+    //   further redraws while drawing
+    uint16_t  anRedrawInd[GSLC_REDRAW_IND_MAX];
+    uint8_t   nRedrawIndCnt = pCollect->nRedrawIndCnt;
+    memcpy(anRedrawInd,pCollect->anRedrawInd,nRedrawIndCnt*sizeof(uint16_t));
+
+    for (nInd=0;nInd<nRedrawIndCnt;nInd++) {
+      pElemRef = &(pCollect->asElemRef[anRedrawInd[nInd]]);
+
+      gslc_tsEvent sEventNew = sEvent;
+      sEventNew.pvScope = (void*)(pElemRef);
+      gslc_ElemEvent(pvGui,sEventNew);
+    } // nInd
+    #endif // GSLC_REDRAW_IND_MAX
+
   } else if ( (sEvent.eType == GSLC_EVT_DRAW) || (sEvent.eType == GSLC_EVT_TICK) ) {
     // DRAW and TICK are propagated down to all elements in collection
 
@@ -5403,9 +7362,26 @@ gslc_tsElemRef* gslc_CollectElemAdd(gslc_tsGui* pGui,gslc_tsCollect* pCollect,co
     // - This performs a copy so that we can discard the element
     //   pointer after the call is complete
     nElemInd = pCollect->nElemCnt;
+    #if (GSLC_ELEM_COMPACT)
+    // Copy the attributes to the collection's attribute array
+    // - The element may already refer to its slot (see ElemCreate)
+    if ((pCollect->asElemAttr == NULL) || (pElem->pAttr == NULL)) {
+      GSLC_DEBUG2_PRINT("ERROR: CollectElemAdd() no element attribute storage, ElemID=%d\n",pElem->nId);
+      return NULL;
+    }
+    if (pElem->pAttr != &(pCollect->asElemAttr[nElemInd])) {
+      pCollect->asElemAttr[nElemInd] = *(pElem->pAttr);
+    }
+    #endif
     pCollect->asElem[nElemInd] = *pElem;
+    #if (GSLC_ELEM_COMPACT)
+    pCollect->asElem[nElemInd].pAttr = &(pCollect->asElemAttr[nElemInd]);
+    #endif
     pCollect->nElemCnt++;
 
+    // Convert the element colors once so that redraws don't repeat it
+    gslc_ElemColRawUpdate(pGui,&(pCollect->asElem[nElemInd]));
+
     // Add a reference
     // - Pointer (pElem) links to an item of internal element array
     nElemRefInd = pCollect->nElemRefCnt;
@@ -5418,13 +7394,13 @@ gslc_tsElemRef* gslc_CollectElemAdd(gslc_tsGui* pGui,gslc_tsCollect* pCollect,co
     // - Pointer (pElem) links to an element stored in FLASH (must be declared statically)
 
     // Fetch a RAM copy of the FLASH element
-    #if (GSLC_USE_PROGMEM)
+    #if (GSLC_PROGMEM_COPY)
     memcpy_P(&pGui->sElemTmpProg,pElem,sizeof(gslc_tsElem));
     #endif
 
     #if defined(DBG_LOG)
       const gslc_tsElem* pElemRam = pElem; // Local element in RAM
-      #if (GSLC_USE_PROGMEM)
+      #if (GSLC_PROGMEM_COPY)
         pElemRam = &pGui->sElemTmpProg;
       #endif
     GSLC_DEBUG_PRINT("INFO:   Add elem to collection: ElemRef=%d/%d, ElemId=%u (FLASH)\n",
@@ -5441,6 +7417,17 @@ gslc_tsElemRef* gslc_CollectElemAdd(gslc_tsGui* pGui,gslc_tsCollect* pCollect,co
   // Fetch a pointer to the element reference array entry
   gslc_tsElemRef* pElemRef = &(pCollect->asElemRef[nElemRefInd]);
 
+  #if (GSLC_TOUCH_IND_MAX > 0)
+  // The new element needs to be added to the touch index
+  if (pCollect->pTouchInd != NULL) {
+    pCollect->pTouchInd->bValid = false;
+  }
+  #endif
+
+  #if (GSLC_ID_IND_MAX > 0)
+  gslc_CollectIdIndAdd(pGui,pCollect,nElemRefInd);
+  #endif
+
   // Mark any newly added element as requiring redraw
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
 
@@ -5473,6 +7460,97 @@ bool gslc_CollectGetRedraw(gslc_tsGui* pGui,gslc_tsCollect* pCollect)
   return bCollectRedraw;
 }
 
+void gslc_CollectRedrawIndAdd(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
+{
+#if (GSLC_REDRAW_IND_MAX > 0)
+  uint8_t         nInd;
+  uint16_t        nElemRefInd;
+  gslc_tsPage*    pPage = NULL;
+  gslc_tsCollect* pCollect = NULL;
+
+  // Locate the page collection that contains the element reference
+  pPage = gslc_PageFindByElemRef(pGui,pElemRef);
+  if (pPage == NULL) {
+    return;
+  }
+  pCollect = &(pPage->sCollect);
+  if ((!pCollect->bRedrawIndEn) || (pCollect->bRedrawIndOvf)) {
+    return;
+  }
+  nElemRefInd = (uint16_t)(pElemRef - pCollect->asElemRef);
+
+  // Find the insertion point, keeping the index sorted so that
+  // elements are redrawn in z-order
+  for (nInd=0;nInd<pCollect->nRedrawIndCnt;nInd++) {
+    if (pCollect->anRedrawInd[nInd] == nElemRefInd) {
+      // Already pending redraw
+      return;
+    } else if (pCollect->anRedrawInd[nInd] > nElemRefInd) {
+      break;
+    }
+  }
+  if (pCollect->nRedrawIndCnt >= GSLC_REDRAW_IND_MAX) {
+    // Index is full, so fall back to scanning the collection
+    pCollect->bRedrawIndOvf = true;
+    return;
+  }
+  memmove(&(pCollect->anRedrawInd[nInd+1]),&(pCollect->anRedrawInd[nInd]),
+    (pCollect->nRedrawIndCnt-nInd)*sizeof(uint16_t));
+  pCollect->anRedrawInd[nInd] = nElemRefInd;
+  pCollect->nRedrawIndCnt++;
+#else
+  (void)pGui; // Unused
+  (void)pElemRef; // Unused
+#endif // GSLC_REDRAW_IND_MAX
+}
+
+void gslc_CollectRedrawIndUpdate(gslc_tsGui* pGui,gslc_tsCollect* pCollect)
+{
+#if (GSLC_REDRAW_IND_MAX > 0)
+  uint16_t  nInd;
+  uint8_t   nIndOut = 0;
+
+  if (!pCollect->bRedrawIndEn) {
+    return;
+  }
+
+  if (pCollect->bRedrawIndOvf) {
+    // Rebuild the index from a full scan of the collection
+    pCollect->bRedrawIndOvf = false;
+    for (nInd=0;nInd<pCollect->nElemRefCnt;nInd++) {
+      if (gslc_ElemGetRedraw(pGui,&(pCollect->asElemRef[nInd])) != GSLC_REDRAW_NONE) {
+        if (nIndOut >= GSLC_REDRAW_IND_MAX) {
+          pCollect->bRedrawIndOvf = true;
+          break;
+        }
+        pCollect->anRedrawInd[nIndOut++] = nInd;
+      }
+    }
+  } else {
+    // Drop any entries that have since been redrawn
+    for (nInd=0;nInd<pCollect->nRedrawIndCnt;nInd++) {
+      if (gslc_ElemGetRedraw(pGui,&(pCollect->asElemRef[pCollect->anRedrawInd[nInd]])) != GSLC_REDRAW_NONE) {
+        pCollect->anRedrawInd[nIndOut++] = pCollect->anRedrawInd[nInd];
+      }
+    }
+  }
+  pCollect->nRedrawIndCnt = nIndOut;
+#else
+  (void)pGui; // Unused
+  (void)pCollect; // Unused
+#endif // GSLC_REDRAW_IND_MAX
+}
+
+bool gslc_CollectRedrawIndValid(gslc_tsCollect* pCollect)
+{
+#if (GSLC_REDRAW_IND_MAX > 0)
+  return ((pCollect->bRedrawIndEn) && (!pCollect->bRedrawIndOvf));
+#else
+  (void)pCollect; // Unused
+  return false;
+#endif // GSLC_REDRAW_IND_MAX
+}
+
 // Add an element to the collection associated with the page
 //
 // - Depending on the GSLC_ELEMREF_SRC_* setting, CollectElemAdd()
@@ -5521,6 +7599,12 @@ gslc_tsElemRef* gslc_ElemAdd(gslc_tsGui* pGui,int16_t nPageId,gslc_tsElem* pElem
   // Update the page's bounding rect
   gslc_UnionRect(&(pPage->rBounds), pElemLocal->rElem);
 
+  // Register any tick callback that was provided with the element
+  // (eg. for elements in FLASH)
+  if (pElemLocal->pfuncXTick != NULL) {
+    gslc_TickSubSet(pGui,pElemRefAdd,true,false,0);
+  }
+
   return pElemRefAdd;
 }
 
@@ -5568,8 +7652,8 @@ void gslc_ElemSetImage(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsImgRef s
   #else
     // Detect to see if a redraw is needed
     bool bImagesEqual = true;
-    bImagesEqual &= gslc_ImgRefEqual(&(pElem->sImgRefNorm),&sImgRef);
-    bImagesEqual &= gslc_ImgRefEqual(&(pElem->sImgRefGlow),&sImgRefSel);
+    bImagesEqual &= gslc_ImgRefEqual(&(GSLC_ELEM_ATTR(pElem)->sImgRefNorm),&sImgRef);
+    bImagesEqual &= gslc_ImgRefEqual(&(GSLC_ELEM_ATTR(pElem)->sImgRefGlow),&sImgRefSel);
   #endif
   
   // Update the normal and glowing images
@@ -5619,9 +7703,80 @@ bool gslc_GuiRotate(gslc_tsGui* pGui, uint8_t nRotation)
   return bOk;
 }
 
+// Add an event to the deferred event queue
+// - If the queue is full, then the oldest event is issued immediately.
+bool gslc_EventQueueAdd(gslc_tsGui* pGui,gslc_tsEvent sEvent,const gslc_tsEventTouch* pEventTouch)
+{
+  if (pGui == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "EventQueueAdd";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return false;
+  }
+
+  gslc_tsEventQueueEntry  sEntryOld;
+  bool                    bEntryOld = false;
+  gslc_tsEventQueueEntry* pEntry = NULL;
+
+  if (pGui->nEventQueueCnt >= GSLC_EVENT_QUEUE_MAX) {
+    // Remove the oldest event so that it can be issued once
+    // the new event has been queued behind it
+    sEntryOld = pGui->asEventQueue[pGui->nEventQueueHead];
+    bEntryOld = true;
+    pGui->nEventQueueHead = (uint8_t)((pGui->nEventQueueHead + 1) % GSLC_EVENT_QUEUE_MAX);
+    pGui->nEventQueueCnt--;
+    pGui->sEventQueueStats.nOvfCnt++;
+  }
+
+  pEntry = &(pGui->asEventQueue[(pGui->nEventQueueHead + pGui->nEventQueueCnt) % GSLC_EVENT_QUEUE_MAX]);
+  pEntry->sEvent = sEvent;
+  pEntry->bEventTouch = (pEventTouch != NULL);
+  if (pEventTouch != NULL) {
+    pEntry->sEventTouch = *pEventTouch;
+  }
+  pGui->nEventQueueCnt++;
+
+  pGui->sEventQueueStats.nEventCnt++;
+  if (pGui->nEventQueueCnt > pGui->sEventQueueStats.nPeakCnt) {
+    pGui->sEventQueueStats.nPeakCnt = pGui->nEventQueueCnt;
+  }
+
+  if (bEntryOld) {
+    if (sEntryOld.bEventTouch) {
+      sEntryOld.sEvent.pvData = (void*)&(sEntryOld.sEventTouch);
+    }
+    gslc_ElemEvent((void*)pGui,sEntryOld.sEvent);
+  }
+  return true;
+}
+
+uint8_t gslc_EventQueueDrain(gslc_tsGui* pGui,uint8_t nMax)
+{
+  gslc_tsEventQueueEntry sEntry;
+  uint8_t                nCnt = 0;
+
+  // Limit delivery to the events that were queued on entry so
+  // that events raised by the callbacks wait for the next update
+  if (nMax > pGui->nEventQueueCnt) {
+    nMax = pGui->nEventQueueCnt;
+  }
+  while ((nCnt < nMax) && (pGui->nEventQueueCnt > 0)) {
+    // Copy the entry out of the queue before issuing it, as the
+    // callback may add further events
+    sEntry = pGui->asEventQueue[pGui->nEventQueueHead];
+    pGui->nEventQueueHead = (uint8_t)((pGui->nEventQueueHead + 1) % GSLC_EVENT_QUEUE_MAX);
+    pGui->nEventQueueCnt--;
+    if (sEntry.bEventTouch) {
+      sEntry.sEvent.pvData = (void*)&(sEntry.sEventTouch);
+    }
+    gslc_ElemEvent((void*)pGui,sEntry.sEvent);
+    nCnt++;
+  }
+  return nCnt;
+}
+
 // Trigger a touch event on an element
-// - These events are put into the deferred state to be caught on the next update loop
-// - If there is already a deferred event waiting, then it is issued immediately.
+// - These events are added to the deferred event queue to be caught on the next update loop
+// - If the queue is full, then the oldest deferred event is issued immediately.
 bool gslc_ElemSendEventTouch(gslc_tsGui* pGui,gslc_tsElemRef* pElemRefTracked,
         gslc_teTouch eTouch,int16_t nX,int16_t nY)
 {
@@ -5633,21 +7788,13 @@ bool gslc_ElemSendEventTouch(gslc_tsGui* pGui,gslc_tsElemRef* pElemRefTracked,
     return false; //FIXME: Need to add this check!
   }
 
-  // Check to see if the deferred event queue is available
-  if (pGui->bEventPending) {
-    // If the pending slot already has an event, then
-    // service it now and then save the new event into
-    // the pending slot.
-    gslc_ElemEvent((void*)pGui,pGui->sEventPend);
-  }
-  // Now we can save the new event into the pending slot
-  pGui->sEventTouchPend.eTouch = eTouch;
-  pGui->sEventTouchPend.nX = nX;
-  pGui->sEventTouchPend.nY = nY;
-  pGui->sEventPend = gslc_EventCreate(pGui,GSLC_EVT_TOUCH,0,(void*)pElemRefTracked,&(pGui->sEventTouchPend));
-  pGui->bEventPending = true;
-
-  return true;
+  // Add the event to the deferred event queue
+  gslc_tsEventTouch sEventTouch;
+  sEventTouch.eTouch = eTouch;
+  sEventTouch.nX = nX;
+  sEventTouch.nY = nY;
+  gslc_tsEvent sEvent = gslc_EventCreate(pGui,GSLC_EVT_TOUCH,0,(void*)pElemRefTracked,NULL);
+  return gslc_EventQueueAdd(pGui,sEvent,&sEventTouch);
 #endif // !DRV_TOUCH_NONE
 }
 
@@ -5669,26 +7816,6 @@ void gslc_ResetElem(gslc_tsElem* pElem)
   pElem->nType            = GSLC_TYPE_BOX;
   pElem->nGroup           = GSLC_GROUP_ID_NONE;
   pElem->rElem            = (gslc_tsRect){0,0,0,0};
-  pElem->sImgRefNorm      = gslc_ResetImage();
-  pElem->sImgRefGlow      = gslc_ResetImage();
-  pElem->colElemFrame     = GSLC_COL_WHITE;
-  pElem->colElemFill      = GSLC_COL_WHITE;
-  pElem->colElemFrameGlow = GSLC_COL_WHITE;
-  pElem->colElemFillGlow  = GSLC_COL_WHITE;
-  pElem->eTxtFlags        = GSLC_TXT_DEFAULT;
-  #if (GSLC_LOCAL_STR)
-    pElem->pStrBuf[0]       = '\0';
-    pElem->nStrBufMax       = GSLC_LOCAL_STR_LEN;
-  #else
-    pElem->pStrBuf          = NULL;
-    pElem->nStrBufMax       = 0;
-  #endif
-  pElem->colElemText      = GSLC_COL_WHITE;
-  pElem->colElemTextGlow  = GSLC_COL_WHITE;
-  pElem->eTxtAlign        = GSLC_ALIGN_MID_MID;
-  pElem->nTxtMarginX      = 0;
-  pElem->nTxtMarginY      = 0;
-  pElem->pTxtFont         = NULL;
 
   pElem->pXData           = NULL;
   pElem->pfuncXEvent      = NULL; // UNUSED
@@ -5698,6 +7825,39 @@ void gslc_ResetElem(gslc_tsElem* pElem)
 #if (GSLC_FEATURE_COMPOUND)
   pElem->pElemRefParent   = NULL;
 #endif
+#if (GSLC_STYLE_MAX > 0)
+  pElem->nStyleInd        = 0;
+#endif
+
+  // Reset the attributes
+  // - In the compact layout, only once the element has been
+  //   given an attribute record
+  gslc_tsElemAttr* pAttr = GSLC_ELEM_ATTR(pElem);
+#if (GSLC_ELEM_COMPACT)
+  if (pAttr == NULL) {
+    return;
+  }
+#endif
+  pAttr->sImgRefNorm      = gslc_ResetImage();
+  pAttr->sImgRefGlow      = gslc_ResetImage();
+  pAttr->colElemFrame     = GSLC_COL_WHITE;
+  pAttr->colElemFill      = GSLC_COL_WHITE;
+  pAttr->colElemFrameGlow = GSLC_COL_WHITE;
+  pAttr->colElemFillGlow  = GSLC_COL_WHITE;
+  pAttr->eTxtFlags        = GSLC_TXT_DEFAULT;
+  #if (GSLC_LOCAL_STR)
+    pAttr->pStrBuf[0]       = '\0';
+    pAttr->nStrBufMax       = GSLC_LOCAL_STR_LEN;
+  #else
+    pAttr->pStrBuf          = NULL;
+    pAttr->nStrBufMax       = 0;
+  #endif
+  pAttr->colElemText      = GSLC_COL_WHITE;
+  pAttr->colElemTextGlow  = GSLC_COL_WHITE;
+  pAttr->eTxtAlign        = GSLC_ALIGN_MID_MID;
+  pAttr->nTxtMarginX      = 0;
+  pAttr->nTxtMarginY      = 0;
+  pAttr->pTxtFont         = NULL;
 
 }
 
@@ -5725,13 +7885,13 @@ void gslc_ElemDestruct(gslc_tsElem* pElem)
     GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
     return;
   }
-  if (pElem->sImgRefNorm.pvImgRaw != NULL) {
-    gslc_DrvImageDestruct(pElem->sImgRefNorm.pvImgRaw);
-    pElem->sImgRefNorm = gslc_ResetImage();
+  if (GSLC_ELEM_ATTR(pElem)->sImgRefNorm.pvImgRaw != NULL) {
+    gslc_DrvImageDestruct(GSLC_ELEM_ATTR(pElem)->sImgRefNorm.pvImgRaw);
+    GSLC_ELEM_ATTR(pElem)->sImgRefNorm = gslc_ResetImage();
   }
-  if (pElem->sImgRefGlow.pvImgRaw != NULL) {
-    gslc_DrvImageDestruct(pElem->sImgRefGlow.pvImgRaw);
-    pElem->sImgRefGlow = gslc_ResetImage();
+  if (GSLC_ELEM_ATTR(pElem)->sImgRefGlow.pvImgRaw != NULL) {
+    gslc_DrvImageDestruct(GSLC_ELEM_ATTR(pElem)->sImgRefGlow.pvImgRaw);
+    GSLC_ELEM_ATTR(pElem)->sImgRefGlow = gslc_ResetImage();
   }
 
   // TODO: Mark Element valid as false?
@@ -5767,6 +7927,12 @@ void gslc_CollectDestruct(gslc_tsGui* pGui,gslc_tsCollect* pCollect)
   }
   pCollect->nElemRefCnt = 0;
   pCollect->nElemCnt = 0;
+  #if (GSLC_ID_IND_MAX > 0)
+  if (pCollect->pIdInd != NULL) {
+    pCollect->pIdInd->bOvf = false;
+    pCollect->pIdInd->nCnt = 0;
+  }
+  #endif
 
 }
 
@@ -5838,8 +8004,15 @@ void gslc_CollectReset(gslc_tsCollect* pCollect,gslc_tsElem* asElem,uint16_t nEl
 
   uint16_t nInd;
   for (nInd=0;nInd<nElemMax;nInd++) {
+    #if (GSLC_ELEM_COMPACT)
+    // Attributes are assigned by CollectSetElemAttr()
+    pCollect->asElem[nInd].pAttr = NULL;
+    #endif
     gslc_ResetElem(&(pCollect->asElem[nInd]));
   }
+  #if (GSLC_ELEM_COMPACT)
+  pCollect->asElemAttr = NULL;
+  #endif
 
   // Initialize element references
   pCollect->nElemRefMax = nElemRefMax;
@@ -5852,7 +8025,53 @@ void gslc_CollectReset(gslc_tsCollect* pCollect,gslc_tsElem* asElem,uint16_t nEl
   // Reset touch / input tracking
   pCollect->pElemRefTracked = NULL;
   pCollect->nElemIndTracked = GSLC_IND_NONE;
+
+  // Reset redraw tracking
+  #if (GSLC_REDRAW_IND_MAX > 0)
+  pCollect->bRedrawIndEn  = false;
+  pCollect->bRedrawIndOvf = false;
+  pCollect->nRedrawIndCnt = 0;
+  #endif
+
+  // Reset touch index
+  #if (GSLC_TOUCH_IND_MAX > 0)
+  pCollect->pTouchInd = NULL;
+  #endif
+
+  // Reset ID index
+  #if (GSLC_ID_IND_MAX > 0)
+  pCollect->pIdInd = NULL;
+  #endif
+}
+
+#if (GSLC_ELEM_COMPACT)
+bool gslc_CollectSetElemAttr(gslc_tsCollect* pCollect,gslc_tsElemAttr* asElemAttr,uint16_t nElemMax)
+{
+  if ((pCollect == NULL) || (asElemAttr == NULL)) {
+    static const char GSLC_PMEM FUNCSTR[] = "CollectSetElemAttr";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return false;
+  }
+  if (nElemMax < pCollect->nElemMax) {
+    GSLC_DEBUG2_PRINT("ERROR: CollectSetElemAttr() too few attributes (%u/%u)\n",
+            nElemMax,pCollect->nElemMax);
+    return false;
+  }
+  if (pCollect->nElemCnt > 0) {
+    GSLC_DEBUG2_PRINT("ERROR: CollectSetElemAttr() called after elements were added%s\n","");
+    return false;
+  }
+
+  pCollect->asElemAttr = asElemAttr;
+
+  uint16_t nInd;
+  for (nInd=0;nInd<pCollect->nElemMax;nInd++) {
+    pCollect->asElem[nInd].pAttr = &(asElemAttr[nInd]);
+    gslc_ResetElem(&(pCollect->asElem[nInd]));
+  }
+  return true;
 }
+#endif // GSLC_ELEM_COMPACT
 
 
 // Search internal element array for one with a particular ID
@@ -5874,6 +8093,28 @@ gslc_tsElemRef* gslc_CollectFindElemById(gslc_tsGui* pGui,gslc_tsCollect* pColle
     return NULL;
   }
 
+  #if (GSLC_ID_IND_MAX > 0)
+  gslc_tsIdIndex* pIdInd = pCollect->pIdInd;
+  if ((pIdInd != NULL) && (!pIdInd->bOvf)) {
+    // Binary search for the first entry with a matching ID
+    uint16_t nLo = 0;
+    uint16_t nHi = pIdInd->nCnt;
+    uint16_t nMid;
+    while (nLo < nHi) {
+      nMid = (uint16_t)(nLo + (nHi - nLo) / 2);
+      if (pIdInd->asInd[nMid].nId < nElemId) {
+        nLo = (uint16_t)(nMid + 1);
+      } else {
+        nHi = nMid;
+      }
+    }
+    if ((nLo < pIdInd->nCnt) && (pIdInd->asInd[nLo].nId == nElemId)) {
+      pFoundElemRef = &(pCollect->asElemRef[pIdInd->asInd[nLo].nInd]);
+    }
+    return pFoundElemRef;
+  }
+  #endif
+
   for (nInd=0;nInd<pCollect->nElemRefCnt;nInd++) {
     // Fetch the element pointer from the reference array
     pElemRef = &(pCollect->asElemRef[nInd]);
@@ -5889,6 +8130,40 @@ gslc_tsElemRef* gslc_CollectFindElemById(gslc_tsGui* pGui,gslc_tsCollect* pColle
   return pFoundElemRef;
 }
 
+void gslc_CollectIdIndAdd(gslc_tsGui* pGui,gslc_tsCollect* pCollect,uint16_t nElemRefInd)
+{
+  #if (GSLC_ID_IND_MAX > 0)
+  gslc_tsIdIndex* pIdInd = pCollect->pIdInd;
+  if ((pIdInd == NULL) || (pIdInd->bOvf)) {
+    return;
+  }
+  if (pIdInd->nCnt >= GSLC_ID_IND_MAX) {
+    // Index is full, so lookups revert to scanning the collection
+    pIdInd->bOvf = true;
+    return;
+  }
+
+  gslc_tsElem* pElem = gslc_GetElemFromRef(pGui,&(pCollect->asElemRef[nElemRefInd]));
+  int16_t      nId = pElem->nId;
+
+  // Shift up any entries with a greater ID
+  // - Elements are usually added in increasing ID order, so this
+  //   is normally an append
+  uint16_t nPos = pIdInd->nCnt;
+  while ((nPos > 0) && (pIdInd->asInd[nPos-1].nId > nId)) {
+    pIdInd->asInd[nPos] = pIdInd->asInd[nPos-1];
+    nPos--;
+  }
+  pIdInd->asInd[nPos].nId  = nId;
+  pIdInd->asInd[nPos].nInd = nElemRefInd;
+  pIdInd->nCnt++;
+  #else
+  (void)pGui; // Unused
+  (void)pCollect; // Unused
+  (void)nElemRefInd; // Unused
+  #endif
+}
+
 int gslc_CollectGetNextId(gslc_tsGui* pGui,gslc_tsCollect* pCollect)
 {
   (void)pGui; // Unused
@@ -5926,6 +8201,38 @@ gslc_tsElemRef* gslc_CollectFindElemFromCoord(gslc_tsGui* pGui,gslc_tsCollect* p
   *pnElemInd = GSLC_IND_NONE;
 
   if (pCollect->nElemRefCnt == 0) { return NULL; }
+
+  #if (GSLC_TOUCH_IND_MAX > 0)
+  // If a touch index is available, only search the elements
+  // listed in the grid cell containing the coordinate
+  gslc_tsTouchIndex* pTouchInd = pCollect->pTouchInd;
+  if (pTouchInd != NULL) {
+    uint16_t nCellW = (pGui->nDispW + GSLC_TOUCH_GRID_DIV - 1) / GSLC_TOUCH_GRID_DIV;
+    uint16_t nCellH = (pGui->nDispH + GSLC_TOUCH_GRID_DIV - 1) / GSLC_TOUCH_GRID_DIV;
+    // Rebuild the index if elements have changed or the
+    // display dimensions have changed (eg. rotation)
+    if ((!pTouchInd->bValid) || (pTouchInd->nCellW != nCellW) || (pTouchInd->nCellH != nCellH)) {
+      gslc_CollectTouchIndBuild(pGui,pCollect);
+    }
+    if ((!pTouchInd->bOvf) && (nX >= 0) && (nY >= 0) && (nX < (int16_t)pGui->nDispW) && (nY < (int16_t)pGui->nDispH)) {
+      uint8_t   nCell = (nY / nCellH) * GSLC_TOUCH_GRID_DIV + (nX / nCellW);
+      int16_t   nEntry;
+      for (nEntry=(int16_t)pTouchInd->anCellStart[nCell+1]-1;nEntry>=(int16_t)pTouchInd->anCellStart[nCell];nEntry--) {
+        nInd = pTouchInd->anInd[nEntry];
+        pElemRef = &(pCollect->asElemRef[nInd]);
+        if (!gslc_ElemGetVisible(pGui, pElemRef)) {
+          continue;
+        }
+        if (gslc_ElemOwnsCoord(pGui,pElemRef,nX,nY,true)) {
+          *pnElemInd = nInd;
+          return pElemRef;
+        }
+      }
+      return NULL;
+    }
+  }
+  #endif // GSLC_TOUCH_IND_MAX
+
   for (nInd=pCollect->nElemRefCnt-1;nInd>=0;nInd--) {
     pElemRef  = &(pCollect->asElemRef[nInd]);
 
@@ -5947,6 +8254,110 @@ gslc_tsElemRef* gslc_CollectFindElemFromCoord(gslc_tsGui* pGui,gslc_tsCollect* p
 }
 
 
+void gslc_CollectTouchIndBuild(gslc_tsGui* pGui,gslc_tsCollect* pCollect)
+{
+#if (GSLC_TOUCH_IND_MAX > 0)
+  uint16_t        nInd;
+  uint8_t         nCell;
+  uint8_t         nCellX,nCellY;
+  uint8_t         nCellX0,nCellY0,nCellX1,nCellY1;
+  uint8_t         nPass;
+  uint16_t        anCellPos[GSLC_TOUCH_GRID_DIV*GSLC_TOUCH_GRID_DIV];
+  uint16_t        nEntryCnt = 0;
+  int16_t         nX1,nY1;
+  gslc_tsRect     rElem;
+  gslc_tsElemRef* pElemRef = NULL;
+  gslc_tsElem*    pElem = NULL;
+  uint16_t        nCellW = (pGui->nDispW + GSLC_TOUCH_GRID_DIV - 1) / GSLC_TOUCH_GRID_DIV;
+  uint16_t        nCellH = (pGui->nDispH + GSLC_TOUCH_GRID_DIV - 1) / GSLC_TOUCH_GRID_DIV;
+  gslc_tsTouchIndex* pTouchInd = pCollect->pTouchInd;
+
+  if (pTouchInd == NULL) {
+    // No touch index is maintained for this collection
+    return;
+  }
+  pTouchInd->bValid = true;
+  pTouchInd->bOvf = false;
+  pTouchInd->nCellW = nCellW;
+  pTouchInd->nCellH = nCellH;
+  if ((nCellW == 0) || (nCellH == 0)) {
+    pTouchInd->bOvf = true;
+    return;
+  }
+
+  // The first pass counts the entries in each cell and the
+  // second pass fills them in, in increasing z-order
+  memset(anCellPos,0,sizeof(anCellPos));
+  for (nPass=0;nPass<2;nPass++) {
+    for (nInd=0;nInd<pCollect->nElemRefCnt;nInd++) {
+      pElemRef = &(pCollect->asElemRef[nInd]);
+      if (!gslc_ElemGetVisible(pGui,pElemRef)) {
+        continue;
+      }
+      pElem = gslc_GetElemFromRef(pGui,pElemRef);
+      if (!(pElem->nFeatures & GSLC_ELEM_FEA_CLICK_EN)) {
+        continue;
+      }
+      // Note that the extents match the inclusive bounds used by
+      // gslc_IsInRect() for hit-testing
+      rElem = pElem->rElem;
+      nX1 = rElem.x + rElem.w;
+      nY1 = rElem.y + rElem.h;
+      if ((nX1 < 0) || (nY1 < 0) ||
+        (rElem.x >= (int16_t)pGui->nDispW) || (rElem.y >= (int16_t)pGui->nDispH)) {
+        // Element can't be touched
+        continue;
+      }
+      nCellX0 = (rElem.x < 0)? 0 : rElem.x / nCellW;
+      nCellY0 = (rElem.y < 0)? 0 : rElem.y / nCellH;
+      nCellX1 = (nX1 >= (int16_t)pGui->nDispW)? GSLC_TOUCH_GRID_DIV-1 : nX1 / nCellW;
+      nCellY1 = (nY1 >= (int16_t)pGui->nDispH)? GSLC_TOUCH_GRID_DIV-1 : nY1 / nCellH;
+      for (nCellY=nCellY0;nCellY<=nCellY1;nCellY++) {
+        for (nCellX=nCellX0;nCellX<=nCellX1;nCellX++) {
+          nCell = nCellY * GSLC_TOUCH_GRID_DIV + nCellX;
+          if (nPass == 0) {
+            anCellPos[nCell]++;
+          } else {
+            pTouchInd->anInd[anCellPos[nCell]++] = nInd;
+          }
+        }
+      }
+    } // nInd
+
+    if (nPass == 0) {
+      // Convert the counts into the starting position of each cell
+      for (nCell=0;nCell<GSLC_TOUCH_GRID_DIV*GSLC_TOUCH_GRID_DIV;nCell++) {
+        pTouchInd->anCellStart[nCell] = nEntryCnt;
+        nEntryCnt += anCellPos[nCell];
+        anCellPos[nCell] = pTouchInd->anCellStart[nCell];
+      }
+      pTouchInd->anCellStart[nCell] = nEntryCnt;
+      if (nEntryCnt > GSLC_TOUCH_IND_MAX) {
+        // Index is too small, so fall back to scanning the collection
+        pTouchInd->bOvf = true;
+        return;
+      }
+    }
+  } // nPass
+#else
+  (void)pGui; // Unused
+  (void)pCollect; // Unused
+#endif // GSLC_TOUCH_IND_MAX
+}
+
+void gslc_CollectTouchIndInvalidate(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
+{
+#if (GSLC_TOUCH_IND_MAX > 0)
+  gslc_tsPage* pPage = gslc_PageFindByElemRef(pGui,pElemRef);
+  if (pPage != NULL) {
+    pPage->sTouchInd.bValid = false;
+  }
+#else
+  (void)pGui; // Unused
+  (void)pElemRef; // Unused
+#endif // GSLC_TOUCH_IND_MAX
+}
+
 #if (GSLC_FEATURE_COMPOUND)
 // Go through all elements in a collection and set the parent
 // element pointer.
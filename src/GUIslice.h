@@ -63,11 +63,208 @@ extern "C" {
   #define GSLC_PMEM
 #endif
 
+// Provide default for accessing elements stored in FLASH
+// - PROGMEM_COPY: copy each FLASH element (GSLC_ELEMREF_SRC_PROG) into
+//   a temporary RAM element whenever it is accessed. This is only
+//   required on devices where FLASH can't be read in place: AVR, which
+//   has a separate program address space, and ESP8266, which requires
+//   aligned 32-bit reads. Elsewhere (eg. ARM, ESP32) FLASH is memory
+//   mapped and elements are accessed directly.
+#if !defined(GSLC_PROGMEM_COPY)
+  #if (GSLC_USE_PROGMEM) && (defined(__AVR__) || defined(ESP8266))
+    #define GSLC_PROGMEM_COPY 1
+  #else
+    #define GSLC_PROGMEM_COPY 0
+  #endif
+#endif
+
 // Provide default for FOCUS_ON_TOUCH
 #if !defined(GSLC_FEATURE_FOCUS_ON_TOUCH)
   #define GSLC_FEATURE_FOCUS_ON_TOUCH 1
 #endif
 
+// Provide default for touch movement coalescing
+// - When enabled, consecutive touch movement samples that are read
+//   within a single gslc_Update() are collapsed into the most recent
+//   position. Touch down / up transitions are always delivered, and
+//   in order. This allows GSLC_TOUCH_MAX_EVT to be raised without
+//   issuing a callback for every intermediate position.
+#if !defined(GSLC_FEATURE_TOUCH_COALESCE)
+  #define GSLC_FEATURE_TOUCH_COALESCE 0
+#endif
+
+// Provide defaults for the invalidation region list
+// - INVALIDATE_RECT_MAX: maximum number of disjoint rect regions that
+//   are tracked between redraws. Each rect costs one redraw pass.
+// - INVALIDATE_MERGE_PCT: once the invalidated rects cover at least this
+//   percentage of their bounding rect, they are collapsed into a
+//   single rect.
+#if !defined(GSLC_INVALIDATE_RECT_MAX)
+  #define GSLC_INVALIDATE_RECT_MAX 4
+#endif
+#if !defined(GSLC_INVALIDATE_MERGE_PCT)
+  #define GSLC_INVALIDATE_MERGE_PCT 75
+#endif
+#if (GSLC_INVALIDATE_RECT_MAX < 1)
+  #error "CONFIG: GSLC_INVALIDATE_RECT_MAX must be at least 1"
+#endif
+
+// Provide default for the per-collection dirty index
+// - REDRAW_IND_MAX: maximum number of pending element redraws that are
+//   tracked per page collection. If more elements require redraw, the
+//   redraw pass falls back to scanning the entire collection.
+// - Set to 0 to disable the dirty index (always scan)
+#if !defined(GSLC_REDRAW_IND_MAX)
+  #define GSLC_REDRAW_IND_MAX 16
+#endif
+
+// Provide defaults for occlusion culling across the page stack
+// - FEATURE_OCCLUDE: when enabled, a redraw pass skips elements that are
+//   fully covered by opaque elements on a higher layer of the page stack
+//   (eg. a popup dialog) and clips partially covered elements to their
+//   visible portions
+// - OCCLUDE_RECT_MAX: maximum number of rects used to describe the
+//   visible portions of a partially covered element
+#if !defined(GSLC_FEATURE_OCCLUDE)
+  #define GSLC_FEATURE_OCCLUDE 1
+#endif
+#if !defined(GSLC_OCCLUDE_RECT_MAX)
+  #define GSLC_OCCLUDE_RECT_MAX 4
+#endif
+
+// Provide defaults for the deferred event queue
+// - EVENT_QUEUE_MAX: maximum number of events that can be waiting for
+//   delivery. If the queue is full when another event is sent, the
+//   oldest event is delivered immediately to make room.
+// - EVENT_DRAIN_MAX: maximum number of queued events that are delivered
+//   during each call to gslc_Update()
+#if !defined(GSLC_EVENT_QUEUE_MAX)
+  #if defined(__AVR__)
+    #define GSLC_EVENT_QUEUE_MAX 2
+  #else
+    #define GSLC_EVENT_QUEUE_MAX 8
+  #endif
+#endif
+#if (GSLC_EVENT_QUEUE_MAX < 1) || (GSLC_EVENT_QUEUE_MAX > 255)
+  #error "CONFIG: GSLC_EVENT_QUEUE_MAX must be in the range 1..255"
+#endif
+#if !defined(GSLC_EVENT_DRAIN_MAX)
+  #define GSLC_EVENT_DRAIN_MAX GSLC_EVENT_QUEUE_MAX
+#endif
+
+// Provide default for the span buffer
+// - SPAN_BUF_MAX: number of horizontal runs that filled triangles,
+//   quads, circles and sectors collect before they are handed to the
+//   driver (gslc_DrvDrawSpans) in a single call. Each span occupies
+//   6 bytes of RAM.
+#if !defined(GSLC_SPAN_BUF_MAX)
+  #if defined(__AVR__)
+    #define GSLC_SPAN_BUF_MAX 8
+  #else
+    #define GSLC_SPAN_BUF_MAX 64
+  #endif
+#endif
+#if (GSLC_SPAN_BUF_MAX < 1)
+  #error "CONFIG: GSLC_SPAN_BUF_MAX must be at least 1"
+#endif
+
+// Provide default for graphics clipping
+// - CLIP_EN: clip drawing to the region set by gslc_SetClipRect(),
+//   such as the region being redrawn. Primitives are clipped by the
+//   core before they reach the driver: shapes that lie entirely within
+//   the region are passed to the driver unchanged, shapes entirely
+//   outside it are skipped, and the remainder are drawn from clipped
+//   lines, rects and spans.
+#if !defined(GSLC_CLIP_EN)
+  #define GSLC_CLIP_EN 0
+#endif
+
+// Provide default for the tick subscription list
+// - TICK_SUB_MAX: maximum number of page elements with a tick callback
+//   that are tracked. If more elements register a tick callback, then
+//   every element is issued the tick on each update (and tick periods
+//   are ignored).
+// - Set to 0 to disable the subscription list
+#if !defined(GSLC_TICK_SUB_MAX)
+  #define GSLC_TICK_SUB_MAX 8
+#endif
+
+// Provide defaults for the touch hit-testing index
+// - TOUCH_IND_MAX: maximum number of entries in each page's touch index.
+//   The display is divided into a grid and each clickable element has
+//   an entry for every grid cell that it overlaps. If the index is too
+//   small, hit-testing falls back to scanning the page's elements.
+// - TOUCH_GRID_DIV: number of grid divisions along each display axis
+// - Set TOUCH_IND_MAX to 0 to disable the touch index
+#if !defined(GSLC_TOUCH_IND_MAX)
+  #if defined(__AVR__)
+    #define GSLC_TOUCH_IND_MAX 0
+  #else
+    #define GSLC_TOUCH_IND_MAX 64
+  #endif
+#endif
+#if !defined(GSLC_TOUCH_GRID_DIV)
+  #define GSLC_TOUCH_GRID_DIV 4
+#endif
+#if (GSLC_TOUCH_GRID_DIV < 1) || (GSLC_TOUCH_GRID_DIV > 15)
+  #error "CONFIG: GSLC_TOUCH_GRID_DIV must be in the range 1..15"
+#endif
+
+// Provide default for the style table
+// - STYLE_MAX: maximum number of shared styles that can be added with
+//   gslc_StyleAdd(). Each style occupies 20 bytes of RAM, plus its
+//   native colors if GSLC_FEATURE_COLOR_RAW is enabled.
+// - Set to 0 to disable shared styles
+#if !defined(GSLC_STYLE_MAX)
+  #if defined(__AVR__)
+    #define GSLC_STYLE_MAX 0
+  #else
+    #define GSLC_STYLE_MAX 8
+  #endif
+#endif
+
+// Provide default for caching native colors
+// - FEATURE_COLOR_RAW: keep the frame and fill colors of RAM elements and
+//   styles converted to the display's native format, so that redraws
+//   don't convert them again. Costs four native color values of RAM
+//   per element and per style.
+#if !defined(GSLC_FEATURE_COLOR_RAW)
+  #if defined(__AVR__)
+    #define GSLC_FEATURE_COLOR_RAW 0
+  #else
+    #define GSLC_FEATURE_COLOR_RAW 1
+  #endif
+#endif
+
+// Provide default for the element ID index
+// - ID_IND_MAX: maximum number of elements in each page that can be
+//   located by a binary search on their Element ID. If a page contains
+//   more elements, lookups by ID fall back to scanning the page.
+// - Each entry occupies 4 bytes of RAM per page
+// - Set to 0 to disable the ID index
+#if !defined(GSLC_ID_IND_MAX)
+  #if defined(__AVR__)
+    #define GSLC_ID_IND_MAX 0
+  #else
+    #define GSLC_ID_IND_MAX 64
+  #endif
+#endif
+
+// Provide default for the compact element layout
+// - ELEM_COMPACT: store the colors, images and text of each RAM element
+//   in a separate attribute table (see gslc_PageSetElemAttr) so that the
+//   element array only holds the members used when scanning a page
+//   (ID, features, type, region, group and callbacks).
+// - The attributes are reached through GSLC_ELEM_ATTR(pElem)
+// - The ElemCreate*_P() function macros initialize the full element
+//   layout and can't be used in this mode
+#if !defined(GSLC_ELEM_COMPACT)
+  #define GSLC_ELEM_COMPACT 0
+#endif
+#if (GSLC_ELEM_COMPACT) && (GSLC_USE_PROGMEM)
+  #error "CONFIG: GSLC_ELEM_COMPACT is not compatible with GSLC_USE_PROGMEM"
+#endif
+
 // Ensure that touch/input drivers have not been disabled if FEATURE_INPUT has been requested
 // - Either use DRV_TOUCH_INPUT if no touch-screen is used (but external pins are being used)
 // - Or select a DRV_TOUCH_* driver specific to the touch-screen device
@@ -161,6 +358,18 @@ extern GSLC_CB_DEBUG_OUT g_pfDebugOut;
     GSLC_FONT_NONE          = -4999,  ///< No Font ID has been assigned
   } gslc_teFontId;
 
+  /// Style ID enumerations
+  /// - The Style ID is the primary means for user code to
+  ///   reference a shared style.
+  /// - Application code can assign arbitrary Style ID values
+  ///   in the range of 0...16383
+  /// - Negative Style ID values are reserved
+  typedef enum {
+    // Public usage
+    GSLC_STYLE_USER_BASE    = 0,      ///< Starting Style ID for user assignments
+    GSLC_STYLE_NONE         = -5999,  ///< No Style ID has been assigned
+  } gslc_teStyleId;
+
 
   /// Element Index enumerations
   /// - The Element Index is used for internal purposes as an offset
@@ -187,6 +396,7 @@ typedef enum {
 } gslc_teTypeCore;
 
 /// Element features type
+#define GSLC_ELEM_FEA_COLRAW    0x0200      ///< Element holds its native colors (colElem*Raw)
 #define GSLC_ELEM_FEA_NOSHRINK  0x0100      ///< Element can't be shrunk (eg. contains image)
 #define GSLC_ELEM_FEA_VALID     0x0080      ///< Element record is valid
 #define GSLC_ELEM_FEA_FOCUS_EN  0x0040      ///< Element can accept focus
@@ -559,6 +769,57 @@ typedef struct gslc_tsPt {
   int16_t   y;        ///< Y coordinate
 } gslc_tsPt;
 
+/// Define a horizontal run of pixels
+typedef struct gslc_tsSpan {
+  int16_t   nX;       ///< X coordinate of leftmost pixel
+  int16_t   nY;       ///< Y coordinate
+  uint16_t  nW;       ///< Number of pixels in run
+} gslc_tsSpan;
+
+/// Define a run of adjacent points that is being collected
+/// - Used to merge a sequence of points into horizontal and
+///   vertical lines (see gslc_DrawPtRunAdd)
+typedef struct gslc_tsPtRun {
+  int16_t   nX;       ///< X coordinate of first point in run
+  int16_t   nY;       ///< Y coordinate of first point in run
+  uint16_t  nLen;     ///< Number of points in run (0 if empty)
+  int8_t    nDX;      ///< X step between points in run
+  int8_t    nDY;      ///< Y step between points in run
+} gslc_tsPtRun;
+
+/// State for stepping along a polygon edge one row at a time
+/// - The X offset from the upper vertex is kept as a whole part and
+///   a fraction (in units of 1/nDY) so that no multiply or divide is
+///   needed per row
+typedef struct gslc_tsEdgeStep {
+  int16_t   nX;       ///< X coordinate of the upper vertex
+  bool      bPos;     ///< X increases along the edge
+  int32_t   nDY;      ///< Height of the edge (>0)
+  int32_t   nStepQ;   ///< Whole X offset per row
+  int32_t   nStepR;   ///< Fractional X offset per row
+  int32_t   nOfs;     ///< Current whole X offset
+  int32_t   nFrac;    ///< Current fractional X offset
+} gslc_tsEdgeStep;
+
+/// Ring geometry that is retained between sector redraws
+/// - The row tables hold the outermost X of the ring and of its hole
+///   for each row offset from the center (|y| = 0..nRad2)
+/// - The ray table holds the direction of each segment boundary
+///   (x=sin, y=-cos, scaled by 32767)
+/// - The table storage is provided by the owner
+typedef struct gslc_tsRingGeom {
+  bool        bValid;       ///< Tables match the parameters below
+  int16_t     nQuality;     ///< Number of segments per circle
+  int16_t     nRad1;        ///< Inner radius
+  int16_t     nRad2;        ///< Outer radius
+  uint16_t    nRowMax;      ///< Capacity of the row tables
+  uint16_t    nRayMax;      ///< Capacity of the ray table
+  uint16_t    nRayCnt;      ///< Number of valid entries in the ray table
+  int16_t*    anRowOuter;   ///< Outermost X of the ring on each row
+  int16_t*    anRowInner;   ///< Outermost X of the hole on each row (-1 if none)
+  gslc_tsPt*  asRay;        ///< Direction of each segment boundary
+} gslc_tsRingGeom;
+
 /// Color structure. Defines RGB triplet.
 typedef struct gslc_tsColor {
   uint8_t r;      ///< RGB red value
@@ -566,6 +827,15 @@ typedef struct gslc_tsColor {
   uint8_t b;      ///< RGB blue value
 } gslc_tsColor;
 
+/// Native color value, in the format written by the display driver
+/// - Obtained from gslc_ColorToRaw() and used by the gslc_Draw*Raw()
+///   primitives so that repeated draws don't convert the color again
+#if defined(DRV_DISP_SDL1) || defined(DRV_DISP_SDL2)
+  typedef uint32_t gslc_tsColorRaw;
+#else
+  typedef uint16_t gslc_tsColorRaw;
+#endif
+
 /// State associated with an element's region
 /// - This struct is used for gslc_ElemCalcRectState()
 /// - Accounts for various rects including
@@ -582,6 +852,8 @@ typedef struct gslc_tsRectState {
   gslc_tsColor colBack;
   gslc_tsColor colTxtFore;
   gslc_tsColor colTxtBack;
+  gslc_tsColorRaw colFrmRaw;    ///< Native color of colFrm
+  gslc_tsColorRaw colInnerRaw;  ///< Native color of colInner
 } gslc_tsRectState;
 
 /// Event structure
@@ -611,6 +883,25 @@ typedef struct {
   uint16_t              nSize;          ///< Font size
 } gslc_tsFont;
 
+/// Shared style structure
+/// - Elements that reference a style take their colors from
+///   it each time that they are drawn
+typedef struct {
+  int16_t               nId;              ///< Style ID specified by user
+  gslc_tsColor          colFrame;         ///< Color for frame
+  gslc_tsColor          colFill;          ///< Color for background fill
+  gslc_tsColor          colFrameGlow;     ///< Color to use for frame when glowing
+  gslc_tsColor          colFillGlow;      ///< Color to use for fill when glowing
+  gslc_tsColor          colText;          ///< Color of overlay text
+  gslc_tsColor          colTextGlow;      ///< Color of overlay text when glowing
+#if (GSLC_FEATURE_COLOR_RAW)
+  gslc_tsColorRaw       colFrameRaw;      ///< Native color for frame
+  gslc_tsColorRaw       colFillRaw;       ///< Native color for background fill
+  gslc_tsColorRaw       colFrameGlowRaw;  ///< Native color for frame when glowing
+  gslc_tsColorRaw       colFillGlowRaw;   ///< Native color for fill when glowing
+#endif
+} gslc_tsStyle;
+
 
 /// Image reference structure
 typedef struct {
@@ -627,6 +918,59 @@ typedef struct {
   gslc_teElemRefFlags   eElemFlags; ///< Element reference flags
 } gslc_tsElemRef;
 
+#if (GSLC_ELEM_COMPACT)
+///
+/// Element Attribute Struct
+/// - Holds the appearance and text of an element when the compact
+///   element layout is enabled (GSLC_ELEM_COMPACT)
+/// - Stored in a table alongside the element array of a page (or
+///   compound element) and referenced by the element's pAttr
+///
+typedef struct gslc_tsElemAttr {
+  gslc_tsColor        colElemFrame;     ///< Color for frame
+  gslc_tsColor        colElemFill;      ///< Color for background fill
+  gslc_tsColor        colElemFrameGlow; ///< Color to use for frame when glowing
+  gslc_tsColor        colElemFillGlow;  ///< Color to use for fill when glowing
+
+  gslc_tsImgRef       sImgRefNorm;      ///< Image reference to draw (normal)
+  gslc_tsImgRef       sImgRefGlow;      ///< Image reference to draw (glowing)
+
+  // Text handling
+#if (GSLC_LOCAL_STR)
+  char                pStrBuf[GSLC_LOCAL_STR_LEN];  ///< Text string to overlay
+#else
+  char*               pStrBuf;          ///< Ptr to text string buffer to overlay
+#endif
+  uint8_t             nStrBufMax;       ///< Size of string buffer
+  gslc_teTxtFlags     eTxtFlags;        ///< Flags associated with text buffer
+
+  gslc_tsColor        colElemText;      ///< Color of overlay text
+  gslc_tsColor        colElemTextGlow;  ///< Color of overlay text when glowing
+  int8_t              eTxtAlign;        ///< Alignment of overlay text
+  int8_t              nTxtMarginX;      ///< Margin of overlay text within rect region (x offset)
+  int8_t              nTxtMarginY;      ///< Margin of overlay text within rect region (y offset)
+  gslc_tsFont*        pTxtFont;         ///< Ptr to Font for overlay text
+
+  // Native colors
+  // - Only valid if GSLC_ELEM_FEA_COLRAW is set
+#if (GSLC_FEATURE_COLOR_RAW)
+  gslc_tsColorRaw     colElemFrameRaw;     ///< Native color for frame
+  gslc_tsColorRaw     colElemFillRaw;      ///< Native color for background fill
+  gslc_tsColorRaw     colElemFrameGlowRaw; ///< Native color for frame when glowing
+  gslc_tsColorRaw     colElemFillGlowRaw;  ///< Native color for fill when glowing
+#endif
+} gslc_tsElemAttr;
+
+/// Access the attributes (colors, images, text) of an element
+#define GSLC_ELEM_ATTR(pElem) ((pElem)->pAttr)
+#else
+/// The attributes are stored within the element itself
+typedef struct gslc_tsElem gslc_tsElemAttr;
+
+/// Access the attributes (colors, images, text) of an element
+#define GSLC_ELEM_ATTR(pElem) (pElem)
+#endif // GSLC_ELEM_COMPACT
+
 ///
 /// Element Struct
 /// - Represents a single graphic element in the GUIslice environment
@@ -636,6 +980,8 @@ typedef struct {
 /// - Display order of elements in a page is based upon the creation order
 /// - Extensions to the core element types is provided through the
 ///   pXData reference and pfuncX* callback functions.
+/// - The colors, images and text are accessed via GSLC_ELEM_ATTR() so
+///   that they can be stored separately (GSLC_ELEM_COMPACT)
 ///
 typedef struct gslc_tsElem {
 
@@ -646,6 +992,9 @@ typedef struct gslc_tsElem {
   gslc_tsRect         rElem;            ///< Rect region containing element
   int16_t             nGroup;           ///< Group ID that the element belongs to
 
+#if (GSLC_ELEM_COMPACT)
+  gslc_tsElemAttr*    pAttr;            ///< Ptr to colors, images and text of the element
+#else
   gslc_tsColor        colElemFrame;     ///< Color for frame
   gslc_tsColor        colElemFill;      ///< Color for background fill
   gslc_tsColor        colElemFrameGlow; ///< Color to use for frame when glowing
@@ -653,6 +1002,7 @@ typedef struct gslc_tsElem {
 
   gslc_tsImgRef       sImgRefNorm;      ///< Image reference to draw (normal)
   gslc_tsImgRef       sImgRefGlow;      ///< Image reference to draw (glowing)
+#endif
 
   // if (GSLC_FEATURE_COMPOUND)
   /// Parent element reference. Used during redraw
@@ -666,6 +1016,7 @@ typedef struct gslc_tsElem {
   // endif
 
   // Text handling
+#if !(GSLC_ELEM_COMPACT)
 #if (GSLC_LOCAL_STR)
   char                pStrBuf[GSLC_LOCAL_STR_LEN];  ///< Text string to overlay
 #else
@@ -681,6 +1032,7 @@ typedef struct gslc_tsElem {
   int8_t              nTxtMarginX;      ///< Margin of overlay text within rect region (x offset)
   int8_t              nTxtMarginY;      ///< Margin of overlay text within rect region (y offset)
   gslc_tsFont*        pTxtFont;         ///< Ptr to Font for overlay text
+#endif
 
   // Extended data elements
   void*               pXData;           ///< Ptr to extended data structure
@@ -691,11 +1043,58 @@ typedef struct gslc_tsElem {
   GSLC_CB_DRAW        pfuncXDraw;       ///< Callback func ptr for custom drawing
   GSLC_CB_TOUCH       pfuncXTouch;      ///< Callback func ptr for touch
   GSLC_CB_TICK        pfuncXTick;       ///< Callback func ptr for timer/main loop tick
+
+  // Shared style
+  // - Left zero (no style) by the ElemCreate*_P() function macros
+#if (GSLC_STYLE_MAX > 0)
+  uint8_t             nStyleInd;        ///< Style table index plus one, or 0 if no style is referenced
+#endif
+
+  // Native colors
+  // - Only valid if GSLC_ELEM_FEA_COLRAW is set, which is never
+  //   the case for elements stored in FLASH
+#if (GSLC_FEATURE_COLOR_RAW) && !(GSLC_ELEM_COMPACT)
+  gslc_tsColorRaw     colElemFrameRaw;     ///< Native color for frame
+  gslc_tsColorRaw     colElemFillRaw;      ///< Native color for background fill
+  gslc_tsColorRaw     colElemFrameGlowRaw; ///< Native color for frame when glowing
+  gslc_tsColorRaw     colElemFillGlowRaw;  ///< Native color for fill when glowing
+#endif
 } gslc_tsElem;
 
 
 
 
+/// Element ID index entry
+/// - Associates an Element ID with its position in a collection's
+///   element reference array
+typedef struct {
+  int16_t               nId;              ///< Element ID
+  uint16_t              nInd;             ///< Element reference index
+} gslc_tsIdInd;
+
+#if (GSLC_ID_IND_MAX > 0)
+/// Element ID index
+/// - Storage is provided by the page that owns the collection
+typedef struct {
+  bool                  bOvf;             ///< ID index overflowed (full scan required)
+  uint16_t              nCnt;             ///< Number of entries in the ID index
+  gslc_tsIdInd          asInd[GSLC_ID_IND_MAX]; ///< Entries sorted by Element ID
+} gslc_tsIdIndex;
+#endif // GSLC_ID_IND_MAX
+
+#if (GSLC_TOUCH_IND_MAX > 0)
+/// Touch hit-testing index
+/// - Storage is provided by the page that owns the collection
+typedef struct {
+  bool                  bValid;           ///< Touch index is up to date
+  bool                  bOvf;             ///< Touch index overflowed (full scan required)
+  uint16_t              nCellW;           ///< Width of a grid cell when the index was built
+  uint16_t              nCellH;           ///< Height of a grid cell when the index was built
+  uint16_t              anCellStart[GSLC_TOUCH_GRID_DIV*GSLC_TOUCH_GRID_DIV+1]; ///< Start of each grid cell's entries in anInd
+  uint16_t              anInd[GSLC_TOUCH_IND_MAX]; ///< Element reference indices of each grid cell in increasing z-order
+} gslc_tsTouchIndex;
+#endif // GSLC_TOUCH_IND_MAX
+
 /// Element collection struct
 /// - Collections are used to maintain a list of elements and any
 ///   touch tracking status.
@@ -705,6 +1104,9 @@ typedef struct {
   uint16_t              nElemMax;         ///< Maximum number of elements to allocate (in RAM)
   uint16_t              nElemCnt;         ///< Number of elements allocated
   int16_t               nElemAutoIdNext;  ///< Next Element ID for auto-assignment
+  #if (GSLC_ELEM_COMPACT)
+  gslc_tsElemAttr*      asElemAttr;       ///< Array of element attributes (one per element)
+  #endif
 
   gslc_tsElemRef*       asElemRef;        ///< Array of element references
   uint16_t              nElemRefMax;      ///< Maximum number of element references to allocate
@@ -716,6 +1118,27 @@ typedef struct {
   gslc_tsElemRef*       pElemRefTracked;  ///< Element reference currently being touch-tracked (NULL for none)
   int16_t               nElemIndTracked;  ///< Element index currently being touch-tracked (GSLC_IND_NONE for none)
 
+  // Redraw tracking
+  // - The dirty index is only maintained for page collections
+  #if (GSLC_REDRAW_IND_MAX > 0)
+  bool                  bRedrawIndEn;     ///< Dirty index is maintained for this collection
+  bool                  bRedrawIndOvf;    ///< Dirty index overflowed (full scan required)
+  uint8_t               nRedrawIndCnt;    ///< Number of entries in the dirty index
+  uint16_t              anRedrawInd[GSLC_REDRAW_IND_MAX]; ///< Sorted element reference indices pending redraw
+  #endif
+
+  // Touch hit-testing index
+  // - The touch index is only maintained for page collections
+  #if (GSLC_TOUCH_IND_MAX > 0)
+  gslc_tsTouchIndex*    pTouchInd;        ///< Touch index storage (NULL if not maintained)
+  #endif
+
+  // Element ID index
+  // - The ID index is only maintained for page collections
+  #if (GSLC_ID_IND_MAX > 0)
+  gslc_tsIdIndex*       pIdInd;           ///< ID index storage (NULL if not maintained)
+  #endif
+
   // Callback functions
   //GSLC_CB_EVENT         pfuncXEvent;      ///< UNUSED: Callback func ptr for events
 
@@ -740,9 +1163,57 @@ typedef struct {
   // Bounding region
   gslc_tsRect         rBounds;              ///< Bounding rect for page elements
 
+  // Lookup indexes for the page collection
+  // - These are kept out of gslc_tsCollect so that the private
+  //   collections of compound elements don't carry them
+  #if (GSLC_TOUCH_IND_MAX > 0)
+  gslc_tsTouchIndex   sTouchInd;            ///< Touch hit-testing index storage
+  #endif
+  #if (GSLC_ID_IND_MAX > 0)
+  gslc_tsIdIndex      sIdInd;               ///< Element ID index storage
+  #endif
+
 } gslc_tsPage;
 
 
+/// Frame pacing statistics
+/// - Only updated when a target frame rate has been
+///   configured with gslc_SetFrameRate()
+typedef struct {
+  uint32_t              nFrameCnt;            ///< Number of frames rendered
+  uint32_t              nDeferCnt;            ///< Number of updates that deferred a pending redraw
+  uint16_t              nMissCnt;             ///< Number of frames rendered more than one frame period after the redraw was requested
+  uint16_t              nOverBudgetCnt;       ///< Number of frames that took longer to render than the budget
+  uint16_t              nRenderTimeMax;       ///< Longest frame render time (ms)
+} gslc_tsFrameStats;
+
+
+/// Deferred event queue entry
+/// - Touch events carry a copy of their touch data so that
+///   each queued event retains its own coordinates
+typedef struct {
+  gslc_tsEvent          sEvent;               ///< Event to deliver
+  gslc_tsEventTouch     sEventTouch;          ///< Touch data (if bEventTouch=true)
+  bool                  bEventTouch;          ///< Event data refers to sEventTouch
+} gslc_tsEventQueueEntry;
+
+/// Deferred event queue statistics
+typedef struct {
+  uint32_t              nEventCnt;            ///< Number of events added to the queue
+  uint16_t              nOvfCnt;              ///< Number of events delivered early because the queue was full
+  uint8_t               nPeakCnt;             ///< Largest number of events waiting in the queue
+} gslc_tsEventQueueStats;
+
+
+/// Tick subscription
+/// - Tracks an element that has registered a tick callback
+typedef struct {
+  gslc_tsElemRef*       pElemRef;             ///< Element reference receiving the tick
+  uint16_t              nPeriod;              ///< Tick period (ms), or 0 to tick on every update
+  uint32_t              nTimeLast;            ///< Time of the last tick (ms)
+} gslc_tsTickSub;
+
+
 /// Input mapping
 /// - Describes mapping from keyboard or GPIO input
 ///   to a GUI action (such as changing the current
@@ -789,16 +1260,27 @@ typedef struct {
   uint8_t             nFontMax;         ///< Maximum number of fonts to allocate
   uint8_t             nFontCnt;         ///< Number of fonts allocated
 
+  #if (GSLC_STYLE_MAX > 0)
+  gslc_tsStyle        asStyle[GSLC_STYLE_MAX]; ///< Collection of shared styles
+  uint8_t             nStyleCnt;        ///< Number of styles allocated
+  #endif
+
   uint8_t             nRoundRadius;     ///< Radius for rounded elements
 
   gslc_tsColor        sTransCol;        ///< Color used for transparent image regions (GSLC_BMP_TRANS_EN=1)
 
+#if (GSLC_ELEM_COMPACT)
+  gslc_tsElemAttr     sElemAttrTmp;     ///< Attributes of the temporary element
+#endif
+
 #if (GSLC_FEATURE_COMPOUND)
   gslc_tsElem         sElemTmp;         ///< Temporary element
   gslc_tsElemRef      sElemRefTmp;      ///< Temporary element reference
 #endif
 
+#if (GSLC_PROGMEM_COPY)
   gslc_tsElem         sElemTmpProg;     ///< Temporary element for Flash compatibility
+#endif
 
   gslc_teInitStat     eInitStatTouch;   ///< Status of touch initialization
   // TODO: exclude these in DRV_TOUCH_NONE
@@ -819,9 +1301,15 @@ typedef struct {
                                         ///< page redraw command.
 
   // Pending events
-  bool                bEventPending;    ///< Is there an event pending?
-  gslc_tsEventTouch   sEventTouchPend;  ///< A touch event that has been deferred (if bEventPending=true)
-  gslc_tsEvent        sEventPend;       ///< An event that has been deferred (if bEventPending=true)
+  uint8_t             nEventQueueHead;  ///< Index of the oldest event in the deferred event queue
+  uint8_t             nEventQueueCnt;   ///< Number of events in the deferred event queue
+  gslc_tsEventQueueEntry asEventQueue[GSLC_EVENT_QUEUE_MAX]; ///< Deferred event queue (ring buffer)
+  gslc_tsEventQueueStats sEventQueueStats; ///< Deferred event queue statistics
+
+  // Span buffer
+  gslc_tsSpan         asSpanBuf[GSLC_SPAN_BUF_MAX]; ///< Spans waiting to be drawn
+  uint16_t            nSpanBufCnt;      ///< Number of spans in asSpanBuf
+  gslc_tsColorRaw     nSpanBufColRaw;   ///< Native color of the spans in asSpanBuf
 
   // Primary surface definitions
   gslc_tsImgRef       sImgRefBkgnd;     ///< Image reference for background
@@ -829,11 +1317,27 @@ typedef struct {
   uint8_t             nFrameRateCnt;    ///< Diagnostic frame rate count
   uint8_t             nFrameRateStart;  ///< Diagnostic frame rate timestamp
 
+  // Frame pacing
+  uint16_t            nFramePeriod;     ///< Minimum time between redraws (ms), or 0 to redraw on every update
+  uint16_t            nFrameBudget;     ///< Render time budget per frame (ms), or 0 if none
+  uint32_t            nFrameLast;       ///< Time that the last frame was rendered (ms)
+  uint32_t            nFramePendStart;  ///< Time that the pending redraw was first seen (ms)
+  bool                bFramePend;       ///< A redraw has been deferred to a later frame
+  gslc_tsFrameStats   sFrameStats;      ///< Frame pacing statistics
+
+  #if (GSLC_TICK_SUB_MAX > 0)
+  // Tick subscriptions
+  bool                bTickSubOvf;      ///< Tick subscription list overflowed (tick all elements until rebuilt)
+  uint8_t             nTickSubCnt;      ///< Number of tick subscriptions
+  gslc_tsTickSub      asTickSub[GSLC_TICK_SUB_MAX]; ///< Elements that receive tick events
+  #endif
+
 
   // Pages
   gslc_tsPage*        asPage;           ///< Array of all pages defined in system
   uint8_t             nPageMax;         ///< Maximum number of pages that can be defined
   uint8_t             nPageCnt;         ///< Current number of pages defined
+  uint8_t             nPageIndLookup;   ///< Index of the page most recently found by ID
 
   gslc_tsPage*        apPageStack[GSLC_STACK__MAX];       ///< Stack of pages
   bool                abPageStackActive[GSLC_STACK__MAX]; ///< Whether page in stack can receive touch events
@@ -842,10 +1346,20 @@ typedef struct {
   // Redraw of screen (ie. across page stack)
   bool                bScreenNeedRedraw; ///< Screen requires a redraw
   bool                bScreenNeedFlip;   ///< Screen requires a page flip
+  bool                bScreenFlipRgnEn;  ///< Page flip can be limited to asFlipRect[]
+  uint8_t             nFlipRectCnt;      ///< Number of rect regions that require a page flip
+  gslc_tsRect         asFlipRect[GSLC_INVALIDATE_RECT_MAX]; ///< Rect regions that have been drawn since the last page flip
 
-  // Current clip region
-  bool                bInvalidateEn;     ///< A region of the display has been invalidated
-  gslc_tsRect         rInvalidateRect;   ///< The rect region that has been invalidated
+  // Invalidated regions
+  bool                bInvalidateEn;      ///< A region of the display has been invalidated
+  uint8_t             nInvalidateRectCnt; ///< Number of rect regions that have been invalidated
+  gslc_tsRect         asInvalidateRect[GSLC_INVALIDATE_RECT_MAX]; ///< Disjoint rect regions that have been invalidated
+  bool                abInvalidateBkgnd[GSLC_INVALIDATE_RECT_MAX]; ///< Background within invalidated rect is exposed (all layers require redraw)
+
+  // Current redraw pass
+  bool                bRedrawClipEn;      ///< Redraw pass is limited to rRedrawClip
+  gslc_tsRect         rRedrawClip;        ///< The rect region being redrawn in the current pass
+  int8_t              nRedrawStackPage;   ///< Page stack layer being redrawn (GSLC_STACK__MAX if none)
 
   // Callback functions
   //GSLC_CB_EVENT       pfuncXEvent;      ///< UNUSED: Callback func ptr for events
@@ -1024,6 +1538,47 @@ void gslc_Quit(gslc_tsGui* pGui);
 ///
 void gslc_Update(gslc_tsGui* pGui);
 
+///
+/// Configure the target frame rate for the display updates
+/// - When enabled, gslc_Update() continues to handle input and
+///   ticks on every call but coalesces the redraws so that they
+///   occur no more often than the target frame rate
+/// - A frame is reported as missed if a redraw is rendered more
+///   than one frame period after it was first requested (eg. if
+///   gslc_Update() is not being called often enough)
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nFps:        Target frame rate (frames per second),
+///                          or 0 to redraw on every update (default)
+/// \param[in]  nBudgetMs:   Render time budget per frame (ms) above which
+///                          a frame is reported as over budget, or 0 for none
+///
+/// \return None
+///
+void gslc_SetFrameRate(gslc_tsGui* pGui,uint16_t nFps,uint16_t nBudgetMs);
+
+///
+/// Fetch the frame pacing statistics
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[out] pStats:      Ptr to the statistics to fill in
+/// \param[in]  bReset:      If true, reset the statistics after fetching them
+///
+/// \return None
+///
+void gslc_GetFrameStats(gslc_tsGui* pGui,gslc_tsFrameStats* pStats,bool bReset);
+
+///
+/// Fetch the deferred event queue statistics
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[out] pStats:      Ptr to the statistics to fill in
+/// \param[in]  bReset:      If true, reset the statistics after fetching them
+///
+/// \return None
+///
+void gslc_GetEventQueueStats(gslc_tsGui* pGui,gslc_tsEventQueueStats* pStats,bool bReset);
+
 
 ///
 /// Configure the background to use a bitmap image
@@ -1132,6 +1687,17 @@ gslc_tsRect gslc_ExpandRect(gslc_tsRect rRect,int16_t nExpandW,int16_t nExpandH)
 ///
 bool gslc_IsInWH(int16_t nSelX,int16_t nSelY,uint16_t nWidth,uint16_t nHeight);
 
+///
+/// Determine if two rectangular regions overlap
+/// - Rects with zero width or height are treated as empty
+///
+/// \param[in]  rRect1:      First rectangular region
+/// \param[in]  rRect2:      Second rectangular region
+///
+/// \return true if the regions share at least one pixel, false otherwise
+///
+bool gslc_IsRectOverlap(gslc_tsRect rRect1,gslc_tsRect rRect2);
+
 ///
 /// Expand a rect to include another rect
 /// - This routine can be useful to modify an invalidation region to
@@ -1175,6 +1741,12 @@ void gslc_InvalidateRgnScreen(gslc_tsGui* pGui);
 ///
 /// Add a rectangular region to the invalidation region
 /// - This is usually called when an element has been modified
+/// - The invalidation region is maintained as a list of up to
+///   GSLC_INVALIDATE_RECT_MAX disjoint rects. Overlapping rects are
+///   merged, and when the list is full the new rect is merged into
+///   the rect that results in the least additional area.
+/// - If the rects cover most of their bounding rect (see
+///   GSLC_INVALIDATE_MERGE_PCT), the list is collapsed to a single rect.
 ///
 /// \param[in]  pGui:     Pointer to GUI
 /// \param[in]  rAddRect: Rectangle to add to the invalidation region
@@ -1183,6 +1755,33 @@ void gslc_InvalidateRgnScreen(gslc_tsGui* pGui);
 ///
 void gslc_InvalidateRgnAdd(gslc_tsGui* pGui, gslc_tsRect rAddRect);
 
+///
+/// Add a rectangular region to the invalidation region and mark the
+/// background within it as requiring redraw
+/// - This is usually called when an element has been hidden or moved,
+///   exposing the background (and any elements) underneath it
+/// - During the next redraw, the background is repainted within the
+///   invalidated rect and all overlapping elements are redrawn
+///
+/// \param[in]  pGui:     Pointer to GUI
+/// \param[in]  rAddRect: Rectangle to add to the invalidation region
+///
+/// \return none
+///
+void gslc_InvalidateRgnBkgnd(gslc_tsGui* pGui, gslc_tsRect rAddRect);
+
+///
+/// Add a rectangular region to the invalidation region list
+///
+/// \param[in]  pGui:     Pointer to GUI
+/// \param[in]  rAddRect: Rectangle to add to the invalidation region
+/// \param[in]  bBkgnd:   Background within the region requires redraw
+///
+/// \return none
+///
+/// \internal
+void gslc_InvalidateRgnAddBase(gslc_tsGui* pGui, gslc_tsRect rAddRect, bool bBkgnd);
+
 ///
 /// Perform basic clipping of a single point to a clipping region
 ///
@@ -1220,6 +1819,22 @@ bool gslc_ClipLine(gslc_tsRect* pClipRect,int16_t* pnX0,int16_t* pnY0,int16_t* p
 ///
 bool gslc_ClipRect(gslc_tsRect* pClipRect,gslc_tsRect* pRect);
 
+///
+/// Compare the bounding rectangle of a shape against the active
+/// clipping region (gslc_SetClipRect)
+/// - Always reports the shape as visible and inside when clipping
+///   is disabled (GSLC_CLIP_EN=0)
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rBound:      Bounding rectangle of the shape
+/// \param[out] pbInside:    Set to true if the shape lies entirely within
+///                          the region and can be drawn without clipping
+///
+/// \return true if shape is visible, false if it should be discarded
+///
+/// \internal
+bool gslc_ClipBound(gslc_tsGui* pGui,gslc_tsRect rBound,bool* pbInside);
+
 
 ///
 /// Create an image reference to a bitmap file in LINUX filesystem
@@ -1307,6 +1922,46 @@ int16_t gslc_sinFX(int16_t n64Ang);
 ///
 int16_t gslc_cosFX(int16_t n64Ang);
 
+///
+/// Calculate fixed-point sine and cosine together from fractional degrees
+/// - Depending on configuration, the result is derived from either
+///   floating point math library or fixed point lookup table.
+/// - The lookup table is interpolated linearly between entries, and
+///   both results share a single reduction of the angle
+///
+/// \param[in]   n64Ang       Angle (in units of 1/64 degrees)
+/// \param[out]  pnSin        Fixed-point sine result. Signed 16-bit with
+///                           full scale at 32767.
+/// \param[out]  pnCos        Fixed-point cosine result (scaled as pnSin)
+///
+/// \return none
+///
+void gslc_SinCosFX(int16_t n64Ang,int16_t* pnSin,int16_t* pnCos);
+
+///
+/// Interpolate the sine lookup table at a position in the first quadrant
+///
+/// \param[in]   nPos         Table position in 16.16 fixed point
+///
+/// \return Fixed-point sine result (full scale at 32767)
+///
+/// \internal
+int16_t gslc_SinLutPos(uint32_t nPos);
+
+///
+/// Calculate fixed-point sine and cosine from the lookup table
+/// - Implements gslc_SinCosFX() when GSLC_USE_FLOAT is disabled, but is
+///   available in either configuration (eg. for comparison)
+///
+/// \param[in]   n64Ang       Angle (in units of 1/64 degrees)
+/// \param[out]  pnSin        Fixed-point sine result
+/// \param[out]  pnCos        Fixed-point cosine result
+///
+/// \return none
+///
+/// \internal
+void gslc_SinCosLutFX(int16_t n64Ang,int16_t* pnSin,int16_t* pnCos);
+
 ///
 /// Create a color based on a blend between two colors
 ///
@@ -1346,6 +2001,21 @@ gslc_tsColor gslc_ColorBlend3(gslc_tsColor colStart,gslc_tsColor colMid,gslc_tsC
 ///
 bool gslc_ColorEqual(gslc_tsColor a,gslc_tsColor b);
 
+///
+/// Convert a color to the native format of the display
+/// - The result can be passed to the gslc_Draw*Raw() primitives
+///   to avoid converting the same color on every draw
+/// - The native format depends on the display driver and, for some
+///   drivers, on the display mode, so the result should only be
+///   used after gslc_Init()
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nCol:        Color RGB value to convert
+///
+/// \return Native color value
+///
+gslc_tsColorRaw gslc_ColorToRaw(gslc_tsGui* pGui,gslc_tsColor nCol);
+
 
 // ------------------------------------------------------------------------
 /// @}
@@ -1370,6 +2040,90 @@ bool gslc_ColorEqual(gslc_tsColor a,gslc_tsColor b);
 ///
 void gslc_DrawSetPixel(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol);
 
+///
+/// Set a pixel on the active screen to the given native color
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX:          Pixel X coordinate to set
+/// \param[in]  nY:          Pixel Y coordinate to set
+/// \param[in]  nColRaw:     Native color value from gslc_ColorToRaw()
+///
+/// \return none
+///
+void gslc_DrawSetPixelRaw(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColorRaw nColRaw);
+
+///
+/// Draw an array of points on the active screen
+/// - Consecutive points that are horizontally or vertically adjacent
+///   are merged into lines, so only isolated points are drawn as
+///   individual pixels
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  asPt:        Array of points to draw
+/// \param[in]  nNumPt:      Number of points in array
+/// \param[in]  nCol:        Color RGB value to set
+///
+/// \return none
+///
+void gslc_DrawPoints(gslc_tsGui* pGui,gslc_tsPt* asPt,uint16_t nNumPt,gslc_tsColor nCol);
+
+///
+/// Draw an array of points on the active screen in the given native color
+/// - Consecutive points that are horizontally or vertically adjacent
+///   are merged into lines, so only isolated points are drawn as
+///   individual pixels
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  asPt:        Array of points to draw
+/// \param[in]  nNumPt:      Number of points in array
+/// \param[in]  nColRaw:     Native color value from gslc_ColorToRaw()
+///
+/// \return none
+///
+void gslc_DrawPointsRaw(gslc_tsGui* pGui,gslc_tsPt* asPt,uint16_t nNumPt,gslc_tsColorRaw nColRaw);
+
+///
+/// Reset a point run before use
+///
+/// \param[in]  pRun:        Pointer to point run
+///
+/// \return none
+///
+/// \internal
+void gslc_DrawPtRunInit(gslc_tsPtRun* pRun);
+
+///
+/// Add a point to a run of adjacent points
+/// - If the point doesn't continue the run in a horizontal or
+///   vertical line, then the run is drawn and a new one is started
+/// - The caller must end with gslc_DrawPtRunFlush() and
+///   gslc_DrawSpanFlush()
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pRun:        Pointer to point run
+/// \param[in]  nX:          Point X coordinate
+/// \param[in]  nY:          Point Y coordinate
+/// \param[in]  nColRaw:     Native color of the run
+///
+/// \return none
+///
+/// \internal
+void gslc_DrawPtRunAdd(gslc_tsGui* pGui,gslc_tsPtRun* pRun,int16_t nX,int16_t nY,gslc_tsColorRaw nColRaw);
+
+///
+/// Draw a run of adjacent points and reset it
+/// - Horizontal runs are added to the span buffer, vertical runs
+///   are drawn as a rect one pixel wide and single points as a pixel
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pRun:        Pointer to point run
+/// \param[in]  nColRaw:     Native color of the run
+///
+/// \return none
+///
+/// \internal
+void gslc_DrawPtRunFlush(gslc_tsGui* pGui,gslc_tsPtRun* pRun,gslc_tsColorRaw nColRaw);
+
 
 ///
 /// Draw an arbitrary line using Bresenham's algorithm
@@ -1385,6 +2139,20 @@ void gslc_DrawSetPixel(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol)
 ///
 void gslc_DrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColor nCol);
 
+///
+/// Draw an arbitrary line using Bresenham's algorithm using a native color
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX0:         X coordinate of line startpoint
+/// \param[in]  nY0:         Y coordinate of line startpoint
+/// \param[in]  nX1:         X coordinate of line endpoint
+/// \param[in]  nY1:         Y coordinate of line endpoint
+/// \param[in]  nColRaw:     Native color value from gslc_ColorToRaw()
+///
+/// \return none
+///
+void gslc_DrawLineRaw(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColorRaw nColRaw);
+
 
 ///
 /// Draw a horizontal line
@@ -1400,6 +2168,20 @@ void gslc_DrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t
 ///
 void gslc_DrawLineH(gslc_tsGui* pGui,int16_t nX, int16_t nY, uint16_t nW,gslc_tsColor nCol);
 
+///
+/// Draw a horizontal line using a native color
+/// - Note that direction of line is in +ve X axis
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX:          X coordinate of line startpoint
+/// \param[in]  nY:          Y coordinate of line startpoint
+/// \param[in]  nW:          Width of line (in +X direction)
+/// \param[in]  nColRaw:     Native color value from gslc_ColorToRaw()
+///
+/// \return none
+///
+void gslc_DrawLineHRaw(gslc_tsGui* pGui,int16_t nX, int16_t nY, uint16_t nW,gslc_tsColorRaw nColRaw);
+
 
 ///
 /// Draw a vertical line
@@ -1415,6 +2197,20 @@ void gslc_DrawLineH(gslc_tsGui* pGui,int16_t nX, int16_t nY, uint16_t nW,gslc_ts
 ///
 void gslc_DrawLineV(gslc_tsGui* pGui,int16_t nX, int16_t nY, uint16_t nH,gslc_tsColor nCol);
 
+///
+/// Draw a vertical line using a native color
+/// - Note that direction of line is in +ve Y axis
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX:          X coordinate of line startpoint
+/// \param[in]  nY:          Y coordinate of line startpoint
+/// \param[in]  nH:          Height of line (in +Y direction)
+/// \param[in]  nColRaw:     Native color value from gslc_ColorToRaw()
+///
+/// \return none
+///
+void gslc_DrawLineVRaw(gslc_tsGui* pGui,int16_t nX, int16_t nY, uint16_t nH,gslc_tsColorRaw nColRaw);
+
 
 ///
 /// Draw a polar ray segment
@@ -1444,6 +2240,17 @@ void gslc_DrawLinePolar(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nRadStar
 ///
 void gslc_DrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol);
 
+///
+/// Draw a framed rectangle using a native color
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Rectangular region to frame
+/// \param[in]  nColRaw:     Native color value from gslc_ColorToRaw()
+///
+/// \return none
+///
+void gslc_DrawFrameRectRaw(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColorRaw nColRaw);
+
 ///
 /// Draw a framed rounded rectangle
 ///
@@ -1456,6 +2263,22 @@ void gslc_DrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol);
 ///
 void gslc_DrawFrameRoundRect(gslc_tsGui* pGui, gslc_tsRect rRect, int16_t nRadius, gslc_tsColor nCol);
 
+///
+/// Draw a framed rounded rectangle from straight edges and
+/// corner points, each of which is clipped
+/// - Used when the driver doesn't provide rounded rects or
+///   the rect is partially clipped
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Rectangular region to frame
+/// \param[in]  nRadius:     Radius for the rounded corners
+/// \param[in]  nColRaw:     Native color value of the frame
+///
+/// \return none
+///
+/// \internal
+void gslc_DrawFrameRoundRectArcs(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadius,gslc_tsColorRaw nColRaw);
+
 ///
 /// Draw a filled rectangle
 ///
@@ -1467,6 +2290,34 @@ void gslc_DrawFrameRoundRect(gslc_tsGui* pGui, gslc_tsRect rRect, int16_t nRadiu
 ///
 void gslc_DrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol);
 
+///
+/// Draw a filled rectangle using a native color
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Rectangular region to fill
+/// \param[in]  nColRaw:     Native color value from gslc_ColorToRaw()
+///
+/// \return none
+///
+void gslc_DrawFillRectRaw(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColorRaw nColRaw);
+
+///
+/// Copy a rectangular region of the display to another position
+/// - Used to scroll the contents of an element without redrawing it
+/// - The copy is only performed if the driver supports it and both
+///   the source and destination lie entirely within the clipping
+///   region and are not overlapped by a higher page in the stack.
+///   Otherwise the caller is expected to redraw the region instead.
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rSrc:        Rectangular region to copy
+/// \param[in]  nDstX:       X coordinate of destination top-left corner
+/// \param[in]  nDstY:       Y coordinate of destination top-left corner
+///
+/// \return true if the region was copied, false if the caller must redraw
+///
+bool gslc_DrawCopyRect(gslc_tsGui* pGui,gslc_tsRect rSrc,int16_t nDstX,int16_t nDstY);
+
 ///
 /// Draw a filled rounded rectangle
 ///
@@ -1479,6 +2330,22 @@ void gslc_DrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol);
 ///
 void gslc_DrawFillRoundRect(gslc_tsGui* pGui, gslc_tsRect rRect, int16_t nRadius, gslc_tsColor nCol);
 
+///
+/// Rasterize a filled rounded rectangle into the span buffer
+/// - A filled circle is drawn as a square whose corner radius is
+///   half its width
+/// - The caller must end with gslc_DrawSpanFlush()
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Rectangular region to fill
+/// \param[in]  nRadius:     Radius for the rounded corners
+/// \param[in]  nColRaw:     Native color value of the fill
+///
+/// \return none
+///
+/// \internal
+void gslc_DrawFillRoundRectSpans(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadius,gslc_tsColorRaw nColRaw);
+
 ///
 /// Draw a framed circle
 ///
@@ -1525,6 +2392,21 @@ void gslc_DrawFillCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,
 void gslc_DrawFrameTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
     int16_t nX1,int16_t nY1,int16_t nX2,int16_t nY2,gslc_tsColor nCol);
 
+///
+/// Calculate the bounding rectangle of a triangle
+///
+/// \param[in]  nX0:         X Coordinate #1
+/// \param[in]  nY0:         Y Coordinate #1
+/// \param[in]  nX1:         X Coordinate #2
+/// \param[in]  nY1:         Y Coordinate #2
+/// \param[in]  nX2:         X Coordinate #3
+/// \param[in]  nY2:         Y Coordinate #3
+///
+/// \return Bounding rectangle
+///
+/// \internal
+gslc_tsRect gslc_GetTriangleBound(int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,int16_t nX2,int16_t nY2);
+
 
 ///
 /// Draw a filled triangle
@@ -1545,84 +2427,342 @@ void gslc_DrawFillTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
 
 
 ///
-/// Draw a framed quadrilateral
+/// Draw a framed quadrilateral
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  psPt:        Pointer to array of 4 points
+/// \param[in]  nCol:        Color RGB value for the frame
+///
+/// \return true if success, false if error
+///
+void gslc_DrawFrameQuad(gslc_tsGui* pGui,gslc_tsPt* psPt,gslc_tsColor nCol);
+
+
+///
+/// Draw a filled quadrilateral
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  psPt:        Pointer to array of 4 points
+/// \param[in]  nCol:        Color RGB value for the frame
+///
+/// \return true if success, false if error
+///
+void gslc_DrawFillQuad(gslc_tsGui* pGui,gslc_tsPt* psPt,gslc_tsColor nCol);
+
+///
+/// Draw a gradient filled sector of a circle with support for inner and outer radius
+/// - Can be used to create a ring or pie chart
+/// - Note that the gradient fill is defined by both the color stops (cArcStart..cArcEnd) as well as
+///   a gradient angular range (nAngGradStart..nAngGradStart+nAngGradRange). This gradient angular
+///   range can be differeng from the drawing angular range (nAngSegStart..nAngSecEnd) to enable
+///   more advanced control styling / updates.
+///
+/// \param[in]  pGui:          Pointer to GUI
+/// \param[in]  nQuality:      Number of segments used to depict a full circle.
+///                            The higher the value, the smoother the resulting
+///                            arcs. A value of 72 provides 360/72=5 degrees per
+///                            segment which is a reasonable compromise between
+///                            smoothness and performance. Note that 360/nQuality
+///                            should be an integer result, thus the allowable
+///                            quality settings are: 360 (max quality), 180, 120,
+///                            90, 72, 60, 45, 40, 36 (low quality), etc. 
+/// \param[in]  nMidX:         Midpoint X coordinate of circle
+/// \param[in]  nMidY:         Midpoint Y coordinate of circle
+/// \param[in]  nRad1:         Inner sector radius (0 for sector / pie, non-zero for ring)
+/// \param[in]  nRad2:         Outer sector radius. Delta from nRad1 defines ring thickness.
+/// \param[in]  cArcStart:     Start color for gradient fill (with angular range defined by nAngGradStart,nAngGradRange)
+/// \param[in]  cArcEnd:       End color for gradient fill
+/// \param[in]  nAngSecStart:  Angle of start of sector drawing (0 at top), measured in degrees.
+/// \param[in]  nAngSecEnd:    Angle of end of sector drawing (0 at top), measured in degrees.
+/// \param[in]  nAngGradStart: For gradient fill, defines the starting angle associated with the starting color (cArcStart)
+/// \param[in]  nAngGradRange: For gradient fill, defines the angular range associated with the start-to-end color range (cArcStart..cArcEnd)
+///
+/// \return none
+///
+void gslc_DrawFillGradSector(gslc_tsGui* pGui, int16_t nQuality, int16_t nMidX, int16_t nMidY, int16_t nRad1, int16_t nRad2,
+  gslc_tsColor cArcStart, gslc_tsColor cArcEnd, int16_t nAngSecStart, int16_t nAngSecEnd, int16_t nAngGradStart, int16_t nAngGradRange);
+
+///
+/// Draw a flat filled sector of a circle with support for inner and outer radius
+/// - Can be used to create a ring or pie chart
+///
+///
+/// \param[in]  pGui:          Pointer to GUI
+/// \param[in]  nQuality:      Number of segments used to depict a full circle.
+///                            The higher the value, the smoother the resulting
+///                            arcs. A value of 72 provides 360/72=5 degrees per
+///                            segment which is a reasonable compromise between
+///                            smoothness and performance.
+/// \param[in]  nMidX:         Midpoint X coordinate of circle
+/// \param[in]  nMidY:         Midpoint Y coordinate of circle
+/// \param[in]  nRad1:         Inner sector radius (0 for sector / pie, non-zero for ring)
+/// \param[in]  nRad2:         Outer sector radius. Delta from nRad1 defines ring thickness.
+/// \param[in]  cArc:          Color for flat fill
+/// \param[in]  nAngSecStart:  Angle of start of sector drawing (0 at top), measured in degrees.
+/// \param[in]  nAngSecEnd:    Angle of end of sector drawing (0 at top), measured in degrees.
+///
+/// \return none
+///
+void gslc_DrawFillSector(gslc_tsGui* pGui, int16_t nQuality, int16_t nMidX, int16_t nMidY, int16_t nRad1, int16_t nRad2,
+  gslc_tsColor cArc, int16_t nAngSecStart, int16_t nAngSecEnd);
+
+///
+/// Add a horizontal run of pixels to the span buffer
+/// - The buffer is flushed first if it is full or if it holds
+///   spans of a different color
+/// - The caller must end with gslc_DrawSpanFlush()
+///
+/// \param[in]  pGui:          Pointer to GUI
+/// \param[in]  nX:            X coordinate of leftmost pixel
+/// \param[in]  nY:            Y coordinate of run
+/// \param[in]  nW:            Number of pixels in run
+/// \param[in]  nColRaw:       Native color of run
+///
+/// \return none
+///
+/// \internal
+void gslc_DrawSpanAdd(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nW,gslc_tsColorRaw nColRaw);
+
+///
+/// Draw any spans waiting in the span buffer
+/// - Uses gslc_DrvDrawSpans() if the driver supports it
+///   (DRV_HAS_DRAW_SPANS), otherwise fills each span as a rect
+///
+/// \param[in]  pGui:          Pointer to GUI
+///
+/// \return none
+///
+/// \internal
+void gslc_DrawSpanFlush(gslc_tsGui* pGui);
+
+///
+/// Start stepping along an edge from its upper vertex
+///
+/// \param[out] pEdge:         Pointer to edge state
+/// \param[in]  nXa:           X coordinate of upper vertex
+/// \param[in]  nYa:           Y coordinate of upper vertex
+/// \param[in]  nXb:           X coordinate of lower vertex
+/// \param[in]  nYb:           Y coordinate of lower vertex (must be > nYa)
+///
+/// \return none
+///
+/// \internal
+void gslc_EdgeStepInit(gslc_tsEdgeStep* pEdge,int16_t nXa,int16_t nYa,int16_t nXb,int16_t nYb);
+
+///
+/// Get the X coordinate of an edge on the current row (rounded)
+///
+/// \param[in]  pEdge:         Pointer to edge state
+///
+/// \return X coordinate
+///
+/// \internal
+int16_t gslc_EdgeStepGetX(gslc_tsEdgeStep* pEdge);
+
+///
+/// Advance an edge to the next row
+///
+/// \param[in]  pEdge:         Pointer to edge state
+///
+/// \return none
+///
+/// \internal
+void gslc_EdgeStepNext(gslc_tsEdgeStep* pEdge);
+
+///
+/// Rasterize a filled triangle into the span buffer
+/// - Each edge is stepped incrementally from its upper vertex, so
+///   triangles sharing an edge (eg. the halves of a quad) meet
+///   without a seam
+/// - Rows are filled from the top vertex down to, but excluding,
+///   the bottom vertex
+///
+/// \param[in]  pGui:          Pointer to GUI
+/// \param[in]  nX0:           X Coordinate #1
+/// \param[in]  nY0:           Y Coordinate #1
+/// \param[in]  nX1:           X Coordinate #2
+/// \param[in]  nY1:           Y Coordinate #2
+/// \param[in]  nX2:           X Coordinate #3
+/// \param[in]  nY2:           Y Coordinate #3
+/// \param[in]  bSkipEdge01:   Leave out the pixels of the edge between
+///                            coordinates #1 and #2, eg. if it is shared
+///                            with a triangle that has already been filled
+/// \param[in]  nColRaw:       Native color of fill
+///
+/// \return none
+///
+/// \internal
+void gslc_DrawFillTriangleSpans(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
+    int16_t nX1,int16_t nY1,int16_t nX2,int16_t nY2,bool bSkipEdge01,gslc_tsColorRaw nColRaw);
+
+///
+/// Determine the pixels on a row that lie in the half-plane
+/// spanning the 180 degrees clockwise from a ray
+/// - Pixels on the ray itself are included and those on the
+///   opposite ray are excluded
+/// - The center pixel is treated as lying at 0 degrees, so it
+///   belongs to exactly one of a set of adjoining sectors
+///
+/// \param[in]  nDX:           X component of the ray direction
+/// \param[in]  nDY:           Y component of the ray direction
+/// \param[in]  nY:            Row offset from the circle center
+/// \param[out] pnXMin:        Leftmost X offset in the half-plane
+/// \param[out] pnXMax:        Rightmost X offset in the half-plane
+///                            (the range is empty if *pnXMin > *pnXMax)
+///
+/// \return none
+///
+/// \internal
+void gslc_ArcHalfPlaneRow(int16_t nDX,int16_t nDY,int16_t nY,int16_t* pnXMin,int16_t* pnXMax);
+
+///
+/// Update the outermost X offsets of a ring and of its hole on a row
+/// - Starts from the values of a nearby row, so stepping from row to
+///   row only needs a few adjustments
+/// - A pixel is kept if its center lies within half a pixel of the radii
+///
+/// \param[in]     nRad1:      Inner radius (0 if no hole)
+/// \param[in]     nRad2:      Outer radius
+/// \param[in]     nYSq:       Square of the row offset from the center
+/// \param[in,out] pnXOuter:   Outermost X offset of the ring
+/// \param[in,out] pnXInner:   Outermost X offset of the hole (-1 if the
+///                            row misses the hole)
+///
+/// \return none
+///
+/// \internal
+void gslc_RingRowExtent(int16_t nRad1,int16_t nRad2,int32_t nYSq,int16_t* pnXOuter,int16_t* pnXInner);
+
+///
+/// Rasterize a filled annular sector (a ring segment) into the span buffer
+/// - Walks the rows of the ring between the inner and outer radius and
+///   clips each row to the two bounding rays, so the work is proportional
+///   to the number of pixels covered
+/// - A pixel belongs to the sector if its angle lies in
+///   [n64AngStart, n64AngStart+n64AngRange), so adjacent sectors that share
+///   a boundary angle neither overlap nor leave a gap
+///
+/// \param[in]  pGui:          Pointer to GUI
+/// \param[in]  nMidX:         Midpoint X coordinate of circle
+/// \param[in]  nMidY:         Midpoint Y coordinate of circle
+/// \param[in]  nRad1:         Inner radius (0 for a pie sector)
+/// \param[in]  nRad2:         Outer radius
+/// \param[in]  n64AngStart:   Start angle (0 at top, clockwise) in units of 1/64 degree
+/// \param[in]  n64AngRange:   Clockwise angular extent in units of 1/64 degree.
+///                            A range of 360*64 or more fills the whole ring.
+/// \param[in]  psRay:         Directions of the start and end rays (from
+///                            gslc_tsRingGeom) or NULL to calculate them
+/// \param[in]  pGeom:         Ring geometry built for nRad1 and nRad2, or
+///                            NULL to calculate the ring extents
+/// \param[in]  nColRaw:       Native color of fill
+///
+/// \return none
+///
+/// \internal
+void gslc_DrawFillArcSpans(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,int16_t nRad1,int16_t nRad2,
+    int16_t n64AngStart,int32_t n64AngRange,gslc_tsPt* psRay,gslc_tsRingGeom* pGeom,gslc_tsColorRaw nColRaw);
+
+///
+/// Rasterize the arc covering a run of segments into the span buffer
+/// - Uses the segment directions from the retained ring geometry
+///   when they are available
+///
+/// \param[in]  pGui:          Pointer to GUI
+/// \param[in]  nMidX:         Midpoint X coordinate of circle
+/// \param[in]  nMidY:         Midpoint Y coordinate of circle
+/// \param[in]  nRad1:         Inner radius
+/// \param[in]  nRad2:         Outer radius
+/// \param[in]  nStep64:       Angular size of a segment in units of 1/64 degree
+/// \param[in]  nSegFirst:     Index of the first segment
+/// \param[in]  nSegCnt:       Number of segments
+/// \param[in]  pGeom:         Ring geometry or NULL
+/// \param[in]  nColRaw:       Native color of fill
+///
+/// \return none
+///
+/// \internal
+void gslc_DrawFillSectorArc(gslc_tsGui* pGui, int16_t nMidX, int16_t nMidY, int16_t nRad1, int16_t nRad2,
+  int16_t nStep64, int16_t nSegFirst, int16_t nSegCnt, gslc_tsRingGeom* pGeom, gslc_tsColorRaw nColRaw);
+
+///
+/// Draw a filled sector of a circle, optionally using retained ring geometry
+/// - Common implementation of gslc_DrawFillSector() and
+///   gslc_DrawFillGradSector()
 ///
-/// \param[in]  pGui:        Pointer to GUI
-/// \param[in]  psPt:        Pointer to array of 4 points
-/// \param[in]  nCol:        Color RGB value for the frame
+/// \param[in]  pGui:          Pointer to GUI
+/// \param[in]  nQuality:      Number of segments used to depict a full circle
+/// \param[in]  nMidX:         Midpoint X coordinate of circle
+/// \param[in]  nMidY:         Midpoint Y coordinate of circle
+/// \param[in]  nRad1:         Inner sector radius
+/// \param[in]  nRad2:         Outer sector radius
+/// \param[in]  cArcStart:     Start color for gradient (or color for flat fill)
+/// \param[in]  cArcEnd:       End color for gradient
+/// \param[in]  bGradient:     Use gradient fill
+/// \param[in]  nAngGradStart: Angle of the gradient start (degrees)
+/// \param[in]  nAngGradRange: Angular range of the gradient (degrees)
+/// \param[in]  nAngSecStart:  Angle of start of sector drawing (degrees)
+/// \param[in]  nAngSecEnd:    Angle of end of sector drawing (degrees)
+/// \param[in]  pGeom:         Ring geometry to use and (re)build as needed,
+///                            or NULL to calculate everything on each call
 ///
-/// \return true if success, false if error
+/// \return none
 ///
-void gslc_DrawFrameQuad(gslc_tsGui* pGui,gslc_tsPt* psPt,gslc_tsColor nCol);
-
+/// \internal
+void gslc_DrawFillSectorBase(gslc_tsGui* pGui, int16_t nQuality, int16_t nMidX, int16_t nMidY, int16_t nRad1, int16_t nRad2,
+  gslc_tsColor cArcStart, gslc_tsColor cArcEnd, bool bGradient, int16_t nAngGradStart, int16_t nAngGradRange,
+  int16_t nAngSecStart, int16_t nAngSecEnd, gslc_tsRingGeom* pGeom);
 
 ///
-/// Draw a filled quadrilateral
+/// Initialize retained ring geometry with the storage for its tables
+/// - The tables are built on the first sector draw that uses them
 ///
-/// \param[in]  pGui:        Pointer to GUI
-/// \param[in]  psPt:        Pointer to array of 4 points
-/// \param[in]  nCol:        Color RGB value for the frame
+/// \param[in]  pGeom:         Pointer to ring geometry
+/// \param[in]  anRowOuter:    Storage for the outer row table
+/// \param[in]  anRowInner:    Storage for the inner row table
+/// \param[in]  nRowMax:       Number of entries in each row table (outer radius + 1)
+/// \param[in]  asRay:         Storage for the ray table
+/// \param[in]  nRayMax:       Number of entries in the ray table
 ///
-/// \return true if success, false if error
+/// \return none
 ///
-void gslc_DrawFillQuad(gslc_tsGui* pGui,gslc_tsPt* psPt,gslc_tsColor nCol);
+void gslc_RingGeomInit(gslc_tsRingGeom* pGeom,int16_t* anRowOuter,int16_t* anRowInner,uint16_t nRowMax,
+  gslc_tsPt* asRay,uint16_t nRayMax);
 
 ///
-/// Draw a gradient filled sector of a circle with support for inner and outer radius
-/// - Can be used to create a ring or pie chart
-/// - Note that the gradient fill is defined by both the color stops (cArcStart..cArcEnd) as well as
-///   a gradient angular range (nAngGradStart..nAngGradStart+nAngGradRange). This gradient angular
-///   range can be differeng from the drawing angular range (nAngSegStart..nAngSecEnd) to enable
-///   more advanced control styling / updates.
+/// Mark retained ring geometry as out of date
+/// - The tables are rebuilt on the next sector draw that uses them
 ///
-/// \param[in]  pGui:          Pointer to GUI
-/// \param[in]  nQuality:      Number of segments used to depict a full circle.
-///                            The higher the value, the smoother the resulting
-///                            arcs. A value of 72 provides 360/72=5 degrees per
-///                            segment which is a reasonable compromise between
-///                            smoothness and performance. Note that 360/nQuality
-///                            should be an integer result, thus the allowable
-///                            quality settings are: 360 (max quality), 180, 120,
-///                            90, 72, 60, 45, 40, 36 (low quality), etc. 
-/// \param[in]  nMidX:         Midpoint X coordinate of circle
-/// \param[in]  nMidY:         Midpoint Y coordinate of circle
-/// \param[in]  nRad1:         Inner sector radius (0 for sector / pie, non-zero for ring)
-/// \param[in]  nRad2:         Outer sector radius. Delta from nRad1 defines ring thickness.
-/// \param[in]  cArcStart:     Start color for gradient fill (with angular range defined by nAngGradStart,nAngGradRange)
-/// \param[in]  cArcEnd:       End color for gradient fill
-/// \param[in]  nAngSecStart:  Angle of start of sector drawing (0 at top), measured in degrees.
-/// \param[in]  nAngSecEnd:    Angle of end of sector drawing (0 at top), measured in degrees.
-/// \param[in]  nAngGradStart: For gradient fill, defines the starting angle associated with the starting color (cArcStart)
-/// \param[in]  nAngGradRange: For gradient fill, defines the angular range associated with the start-to-end color range (cArcStart..cArcEnd)
+/// \param[in]  pGeom:         Pointer to ring geometry
 ///
 /// \return none
 ///
-void gslc_DrawFillGradSector(gslc_tsGui* pGui, int16_t nQuality, int16_t nMidX, int16_t nMidY, int16_t nRad1, int16_t nRad2,
-  gslc_tsColor cArcStart, gslc_tsColor cArcEnd, int16_t nAngSecStart, int16_t nAngSecEnd, int16_t nAngGradStart, int16_t nAngGradRange);
+void gslc_RingGeomInvalidate(gslc_tsRingGeom* pGeom);
 
 ///
-/// Draw a flat filled sector of a circle with support for inner and outer radius
-/// - Can be used to create a ring or pie chart
+/// Ensure that retained ring geometry matches the ring being drawn
+/// - Rebuilds the tables if the parameters differ
 ///
+/// \param[in]  pGeom:         Pointer to ring geometry
+/// \param[in]  nQuality:      Number of segments per circle
+/// \param[in]  nRad1:         Inner radius
+/// \param[in]  nRad2:         Outer radius
 ///
-/// \param[in]  pGui:          Pointer to GUI
-/// \param[in]  nQuality:      Number of segments used to depict a full circle.
-///                            The higher the value, the smoother the resulting
-///                            arcs. A value of 72 provides 360/72=5 degrees per
-///                            segment which is a reasonable compromise between
-///                            smoothness and performance.
-/// \param[in]  nMidX:         Midpoint X coordinate of circle
-/// \param[in]  nMidY:         Midpoint Y coordinate of circle
-/// \param[in]  nRad1:         Inner sector radius (0 for sector / pie, non-zero for ring)
-/// \param[in]  nRad2:         Outer sector radius. Delta from nRad1 defines ring thickness.
-/// \param[in]  cArc:          Color for flat fill
-/// \param[in]  nAngSecStart:  Angle of start of sector drawing (0 at top), measured in degrees.
-/// \param[in]  nAngSecEnd:    Angle of end of sector drawing (0 at top), measured in degrees.
+/// \return true if the row tables can be used, false if the ring is too large
 ///
-/// \return none
+/// \internal
+bool gslc_RingGeomBuild(gslc_tsRingGeom* pGeom,int16_t nQuality,int16_t nRad1,int16_t nRad2);
+
 ///
-void gslc_DrawFillSector(gslc_tsGui* pGui, int16_t nQuality, int16_t nMidX, int16_t nMidY, int16_t nRad1, int16_t nRad2,
-  gslc_tsColor cArc, int16_t nAngSecStart, int16_t nAngSecEnd);
+/// Look up the direction of a segment boundary in retained ring geometry
+///
+/// \param[in]  pGeom:         Pointer to ring geometry (or NULL)
+/// \param[in]  nSegInd:       Index of the segment boundary
+/// \param[out] psRay:         Direction of the boundary
+///
+/// \return true if the boundary was found, false if it isn't in the table
+///
+/// \internal
+bool gslc_RingGeomGetRay(gslc_tsRingGeom* pGeom,int16_t nSegInd,gslc_tsPt* psRay);
 
 // -----------------------------------------------------------------------
 /// @}
@@ -1696,6 +2836,64 @@ gslc_tsFont* gslc_FontGet(gslc_tsGui* pGui,int16_t nFontId);
 bool gslc_FontSetMode(gslc_tsGui* pGui, int16_t nFontId, gslc_teFontRefMode eFontMode);
 
 
+// ------------------------------------------------------------------------
+/// @}
+/// \defgroup _Style_ Style Functions
+/// Functions that manage shared styles
+/// @{
+// ------------------------------------------------------------------------
+
+///
+/// Add a shared style to the GUI
+/// - Elements are attached to the style with gslc_ElemSetStyle()
+/// - Requires GSLC_STYLE_MAX > 0
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  nStyleId:     ID value used to reference the style
+/// \param[in]  colFrame:     Frame color
+/// \param[in]  colFill:      Fill color
+/// \param[in]  colFrameGlow: Frame color when glowing
+/// \param[in]  colFillGlow:  Fill color when glowing
+/// \param[in]  colTxt:       Text color
+/// \param[in]  colTxtGlow:   Text color when glowing
+///
+/// \return true if success, false if error
+///
+bool gslc_StyleAdd(gslc_tsGui* pGui,int16_t nStyleId,gslc_tsColor colFrame,gslc_tsColor colFill,
+  gslc_tsColor colFrameGlow,gslc_tsColor colFillGlow,gslc_tsColor colTxt,gslc_tsColor colTxtGlow);
+
+///
+/// Update the colors of a shared style
+/// - All elements that reference the style pick up the new colors
+///   on their next redraw, and the current page is marked for redraw
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  nStyleId:     ID value used to reference the style (supplied
+///                           originally to gslc_StyleAdd()
+/// \param[in]  colFrame:     Frame color
+/// \param[in]  colFill:      Fill color
+/// \param[in]  colFrameGlow: Frame color when glowing
+/// \param[in]  colFillGlow:  Fill color when glowing
+/// \param[in]  colTxt:       Text color
+/// \param[in]  colTxtGlow:   Text color when glowing
+///
+/// \return true if success, false if error
+///
+bool gslc_StyleSet(gslc_tsGui* pGui,int16_t nStyleId,gslc_tsColor colFrame,gslc_tsColor colFill,
+  gslc_tsColor colFrameGlow,gslc_tsColor colFillGlow,gslc_tsColor colTxt,gslc_tsColor colTxtGlow);
+
+///
+/// Fetch a shared style from its ID value
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  nStyleId:     ID value used to reference the style (supplied
+///                           originally to gslc_StyleAdd()
+///
+/// \return A pointer to the style structure or NULL if error
+///
+gslc_tsStyle* gslc_StyleGet(gslc_tsGui* pGui,int16_t nStyleId);
+
+
 // ------------------------------------------------------------------------
 /// @}
 /// \defgroup _Page_ Page Functions
@@ -1859,6 +3057,24 @@ void gslc_PageAdd(gslc_tsGui* pGui,int16_t nPageId,gslc_tsElem* psElem,uint16_t
 ///
 gslc_tsElemRef* gslc_PageFindElemById(gslc_tsGui* pGui,int16_t nPageId,int16_t nElemId);
 
+#if (GSLC_ELEM_COMPACT)
+/// Assign the element attribute storage for a page
+/// - Required for each page when the compact element layout is
+///   enabled (GSLC_ELEM_COMPACT), before elements are created
+/// - Elements must be added to the page (eg. with ElemAdd) before
+///   the next element is created for the same page
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  nPageId:      Page ID
+/// \param[in]  asElemAttr:   Element attribute array storage
+/// \param[in]  nMaxElem:     Number of entries in asElemAttr. Must be at
+///                           least the nMaxElem passed to PageAdd()
+///
+/// \return true if success, false if error
+///
+bool gslc_PageSetElemAttr(gslc_tsGui* pGui,int16_t nPageId,gslc_tsElemAttr* asElemAttr,uint16_t nMaxElem);
+#endif
+
 
 // ------------------------------------------------------------------------
 /// @}
@@ -2311,6 +3527,46 @@ void gslc_ElemSetTouchFunc(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef, GSLC_CB_T
 ///
 void gslc_ElemSetStyleFrom(gslc_tsGui* pGui,gslc_tsElemRef* pElemRefSrc,gslc_tsElemRef* pElemRefDest);
 
+///
+/// Attach an element to a shared style
+/// - The element's colors are taken from the style until another
+///   style is attached or the element's colors are set directly
+/// - Only elements stored in RAM can reference a style
+///
+/// \param[in]  pGui:          Pointer to GUI
+/// \param[in]  pElemRef:      Pointer to Element reference
+/// \param[in]  nStyleId:      ID of the style (supplied originally to
+///                            gslc_StyleAdd()), or GSLC_STYLE_NONE to
+///                            detach the element from its style
+///
+/// \return true if success, false if error
+///
+bool gslc_ElemSetStyle(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,int16_t nStyleId);
+
+///
+/// Copy the colors of an element's shared style into the element
+///
+/// \param[in]  pGui:          Pointer to GUI
+/// \param[in]  pElem:         Pointer to Element
+///
+/// \return none
+///
+/// \internal
+void gslc_ElemStyleApply(gslc_tsGui* pGui,gslc_tsElem* pElem);
+
+///
+/// Refresh the native colors cached in an element from its
+/// frame and fill colors
+/// - Only to be called for elements stored in RAM
+///
+/// \param[in]  pGui:          Pointer to GUI
+/// \param[in]  pElem:         Pointer to Element
+///
+/// \return none
+///
+/// \internal
+void gslc_ElemColRawUpdate(gslc_tsGui* pGui,gslc_tsElem* pElem);
+
 ///
 /// Reset the element region state struct
 ///
@@ -2540,6 +3796,21 @@ void gslc_ElemSetDrawFunc(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,GSLC_CB_DRAW
 ///
 void gslc_ElemSetTickFunc(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,GSLC_CB_TICK funcCb);
 
+///
+/// Set the interval between tick callbacks for an element
+/// - By default, the tick callback is invoked on every call
+///   to gslc_Update()
+/// - The period is ignored if more than GSLC_TICK_SUB_MAX
+///   elements have registered a tick callback
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+/// \param[in]  nPeriodMs:   Minimum time between ticks (ms), or 0 to tick on every update
+///
+/// \return none
+///
+void gslc_ElemSetTickPeriod(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,uint16_t nPeriodMs);
+
 
 ///
 /// Determine if a coordinate is inside of an element
@@ -3673,11 +4944,83 @@ void gslc_PageSetEventFunc(gslc_tsGui* pGui,gslc_tsPage* pPage,GSLC_CB_EVENT fun
 ///
 void gslc_PageRedrawGo(gslc_tsGui* pGui);
 
+///
+/// Perform a pending redraw if the next frame is due, otherwise
+/// defer it. Updates the frame pacing statistics.
+/// - Only used when a frame rate has been set with gslc_SetFrameRate()
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+/// \internal
+void gslc_UpdateFrame(gslc_tsGui* pGui);
+
+///
+/// Issue a tick to the elements that have registered a tick callback
+/// and whose tick period has elapsed
+/// - If the tick subscription list has overflowed, all elements
+///   on all pages are issued a tick
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+/// \internal
+void gslc_UpdateTick(gslc_tsGui* pGui);
+
+///
+/// Add, update or remove the tick subscription for an element
+/// - Only elements within a page collection are tracked. Elements
+///   within compound elements don't receive ticks.
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+/// \param[in]  bEn:         True to add or update the subscription, false to remove it
+/// \param[in]  bSetPeriod:  True to assign nPeriod, false to retain the current period
+/// \param[in]  nPeriod:     Tick period (ms)
+///
+/// \return none
+///
+/// \internal
+void gslc_TickSubSet(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,bool bEn,bool bSetPeriod,uint16_t nPeriod);
+
+///
+/// Rebuild the tick subscription list after it has overflowed
+/// - Scans the pages for elements with a tick callback. If they
+///   all fit in the list then the overflow state is cleared and
+///   only the subscribed elements receive ticks again.
+/// - Periods are retained for elements that were already in the
+///   list. Any period requested while the list had overflowed is
+///   lost.
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return true if the list was rebuilt, false if it still overflows
+///
+/// \internal
+bool gslc_TickSubRebuild(gslc_tsGui* pGui);
+
+///
+/// Find the page whose collection contains an element reference
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+///
+/// \return Ptr to the page, or NULL if the element reference
+///         isn't part of a page collection (eg. within a compound element)
+///
+/// \internal
+gslc_tsPage* gslc_PageFindByElemRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef);
+
 ///
 /// Indicate whether the screen requires page flip
 /// - This is generally called with bNeeded=true whenever
 ///   drawing has been done to the active page. Page flip
 ///   is actually performed later when calling PageFlipGo().
+/// - Drawing that occurs within a redraw pass adds the pass's
+///   clipping rect to the region to flip. Any other drawing
+///   requires the entire screen to be flipped.
 ///
 /// \param[in]  pGui:        Pointer to GUI
 /// \param[in]  bNeeded:     True if screen requires page flip
@@ -3701,6 +5044,9 @@ bool gslc_PageFlipGet(gslc_tsGui* pGui);
 /// Update the visible screen if page has been marked for flipping
 /// - On some hardware this can trigger a double-buffering
 ///   page flip.
+/// - If the driver supports it (DRV_HAS_PAGE_FLIP_RECT) and all
+///   drawing was limited to the invalidated regions, then only
+///   those regions are transferred to the display.
 ///
 /// \param[in]  pGui:        Pointer to GUI
 ///
@@ -3720,8 +5066,10 @@ gslc_tsPage* gslc_PageFindById(gslc_tsGui* pGui,int16_t nPageId);
 /// Perform a redraw calculation on the page to determine if additional
 /// elements should also be redrawn. This routine checks to see if any
 /// transparent elements have been marked as needing redraw. If so, the
-/// whole page may be marked as needing redraw (or at least the other
-/// elements that have been exposed underneath).
+/// background of the invalidated rect containing the element is marked
+/// as exposed so that the background and the elements underneath are
+/// redrawn within that rect. If no such rect exists, the whole page
+/// is marked as needing redraw.
 ///
 /// \param[in]  pGui:         Pointer to GUI
 ///
@@ -3730,6 +5078,25 @@ gslc_tsPage* gslc_PageFindById(gslc_tsGui* pGui,int16_t nPageId);
 /// \internal
 void gslc_PageRedrawCalc(gslc_tsGui* pGui);
 
+///
+/// Determine the portions of a rect on a page stack layer that are not
+/// covered by opaque elements on the higher layers of the stack
+/// - Only visible, filled elements without rounded corners or custom
+///   drawing are treated as opaque
+/// - If the uncovered portions can't be described within nVisMax rects,
+///   some of the covered area is reported as visible
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  nStackPage:   Page stack layer that contains the rect
+/// \param[in]  rRect:        Rect to test
+/// \param[out] asVis:        Array of rects to receive the visible portions
+/// \param[in]  nVisMax:      Maximum number of rects in asVis
+///
+/// \return Number of visible rects, or 0 if fully covered
+///
+/// \internal
+uint8_t gslc_PageStackGetVisibleRects(gslc_tsGui* pGui,int8_t nStackPage,gslc_tsRect rRect,gslc_tsRect* asVis,uint8_t nVisMax);
+
 
 ///
 /// Create an event structure
@@ -3757,6 +5124,35 @@ gslc_tsEvent gslc_EventCreate(gslc_tsGui* pGui,gslc_teEventType eType,uint8_t nS
 ///
 bool gslc_ElemEvent(void* pvGui,gslc_tsEvent sEvent);
 
+///
+/// Add an event to the deferred event queue
+/// - Queued events are delivered in order by gslc_Update()
+/// - If the queue is full, the oldest event is delivered immediately
+///   to make room, so events are never dropped
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  sEvent:      Event to deliver
+/// \param[in]  pEventTouch: Ptr to touch data to copy into the queue and
+///                          deliver as the event data, or NULL to
+///                          deliver sEvent.pvData unchanged
+///
+/// \return true if success, false if error
+///
+bool gslc_EventQueueAdd(gslc_tsGui* pGui,gslc_tsEvent sEvent,const gslc_tsEventTouch* pEventTouch);
+
+///
+/// Deliver events from the deferred event queue
+/// - Events added while the queue is being drained are left
+///   for the next call
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nMax:        Maximum number of events to deliver
+///
+/// \return Number of events delivered
+///
+/// \internal
+uint8_t gslc_EventQueueDrain(gslc_tsGui* pGui,uint8_t nMax);
+
 
 #if !defined(DRV_TOUCH_NONE)
 ///
@@ -3806,6 +5202,21 @@ bool gslc_ElemSendEventTouch(gslc_tsGui* pGui,gslc_tsElemRef* pElemRefTracked,
 void gslc_CollectReset(gslc_tsCollect* pCollect,gslc_tsElem* asElem,uint16_t nElemMax,
         gslc_tsElemRef* asElemRef,uint16_t nElemRefMax);
 
+#if (GSLC_ELEM_COMPACT)
+/// Assign the element attribute storage for a collection
+/// - Each element of the collection's element array is given the
+///   attribute record at the same index
+///
+/// \param[in]  pCollect:     Pointer to the collection
+/// \param[in]  asElemAttr:   Element attribute array storage
+/// \param[in]  nElemMax:     Number of entries in asElemAttr. Must be at
+///                           least the collection's element array size.
+///
+/// \return true if success, false if error
+///
+bool gslc_CollectSetElemAttr(gslc_tsCollect* pCollect,gslc_tsElemAttr* asElemAttr,uint16_t nElemMax);
+#endif
+
 
 /// Add an element to a collection
 /// - Note that the contents of pElem are copied to the collection's
@@ -3836,6 +5247,46 @@ gslc_tsElemRef* gslc_CollectElemAdd(gslc_tsGui* pGui,gslc_tsCollect* pCollect,co
 bool gslc_CollectGetRedraw(gslc_tsGui* pGui,gslc_tsCollect* pCollect);
 
 
+///
+/// Add an element reference to the dirty index of the page collection
+/// that contains it
+/// - Elements that don't belong to a page collection (eg. those within
+///   compound elements) are ignored
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  pElemRef:     Pointer to Element reference
+///
+/// \return none
+///
+/// \internal
+void gslc_CollectRedrawIndAdd(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef);
+
+///
+/// Remove entries from a collection's dirty index that no longer
+/// require redraw
+/// - If the index had overflowed, it is rebuilt from a scan of the
+///   collection
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  pCollect:     Pointer to Element collection
+///
+/// \return none
+///
+/// \internal
+void gslc_CollectRedrawIndUpdate(gslc_tsGui* pGui,gslc_tsCollect* pCollect);
+
+///
+/// Determine if a collection's dirty index can be used in place of
+/// scanning all of its elements
+///
+/// \param[in]  pCollect:     Pointer to Element collection
+///
+/// \return true if the dirty index is valid, false otherwise
+///
+/// \internal
+bool gslc_CollectRedrawIndValid(gslc_tsCollect* pCollect);
+
+
 /// Find an element in a collection by its Element ID
 ///
 /// \param[in]  pGui:         Pointer to GUI
@@ -3863,6 +5314,47 @@ gslc_tsElemRef* gslc_CollectFindElemById(gslc_tsGui* pGui,gslc_tsCollect* pColle
 ///
 gslc_tsElemRef* gslc_CollectFindElemFromCoord(gslc_tsGui* pGui,gslc_tsCollect* pCollect,int16_t nX, int16_t nY, int16_t* pnElemInd);
 
+///
+/// Rebuild the touch index of a collection
+/// - Each visible, clickable element is listed in every grid
+///   cell that its rect overlaps
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  pCollect:     Pointer to the collection
+///
+/// \return none
+///
+/// \internal
+void gslc_CollectTouchIndBuild(gslc_tsGui* pGui,gslc_tsCollect* pCollect);
+
+///
+/// Mark the touch index of the page containing an element as
+/// requiring a rebuild
+/// - This is called whenever an element's rect, visibility or
+///   clickable state changes
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  pElemRef:     Pointer to Element reference
+///
+/// \return none
+///
+/// \internal
+void gslc_CollectTouchIndInvalidate(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef);
+
+///
+/// Add an element reference to the ID index of a collection
+/// - Entries are kept sorted by Element ID. Elements that share
+///   an ID remain in the order that they were added.
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  pCollect:     Pointer to the collection
+/// \param[in]  nElemRefInd:  Index of the element reference to add
+///
+/// \return none
+///
+/// \internal
+void gslc_CollectIdIndAdd(gslc_tsGui* pGui,gslc_tsCollect* pCollect,uint16_t nElemRefInd);
+
 
 /// Allocate the next available Element ID in a collection
 ///
@@ -4096,6 +5588,8 @@ void gslc_ResetFont(gslc_tsFont* pFont);
 
 ///
 /// Initialize an Element struct
+/// - In the compact element layout (GSLC_ELEM_COMPACT), the attributes
+///   are only initialized if pElem->pAttr has been assigned (non-NULL)
 ///
 /// \param[in]  pElem:       Pointer to Element
 ///
@@ -864,7 +864,7 @@ bool gslc_DrvSetElemImageNorm(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef
   (void)pGui; // Unused
   // This driver doesn't preload the image to memory,
   // so we just save the reference for loading upon render
-  pElem->sImgRefNorm = sImgRef;
+  GSLC_ELEM_ATTR(pElem)->sImgRefNorm = sImgRef;
   return true; // TODO
 }
 
@@ -874,7 +874,7 @@ bool gslc_DrvSetElemImageGlow(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef
   (void)pGui; // Unused
   // This driver doesn't preload the image to memory,
   // so we just save the reference for loading upon render
-  pElem->sImgRefGlow = sImgRef;
+  GSLC_ELEM_ATTR(pElem)->sImgRefGlow = sImgRef;
   return true; // TODO
 }
 
@@ -886,9 +886,8 @@ void gslc_DrvImageDestruct(void* pvImg)
 
 bool gslc_DrvSetClipRect(gslc_tsGui* pGui,gslc_tsRect* pRect)
 {
-  // NOTE: The clipping rect is currently saved in the
-  // driver struct, but the drawing code does not currently
-  // use it.
+  // NOTE: The clipping rect is saved in the driver struct. The core
+  // uses it to clip primitives before they are passed to the driver.
   gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
   if (pRect == NULL) {
     // Default to entire display
@@ -1524,7 +1523,19 @@ inline void gslc_DrvDrawLine_base(int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY
 }
 
 
+gslc_tsColorRaw gslc_DrvColorToRaw(gslc_tsGui* pGui,gslc_tsColor nCol)
+{
+  (void)pGui; // Unused
+  return gslc_DrvAdaptColorToRaw(nCol);
+}
+
+
 bool gslc_DrvDrawPoint(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol)
+{
+  return gslc_DrvDrawPointRaw(pGui,nX,nY,gslc_DrvAdaptColorToRaw(nCol));
+}
+
+bool gslc_DrvDrawPointRaw(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColorRaw nColRaw)
 {
 #if (GSLC_CLIP_EN)
   // Perform clipping
@@ -1532,7 +1543,6 @@ bool gslc_DrvDrawPoint(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol)
   if (!gslc_ClipPt(&pDriver->rClipRect,nX,nY)) { return true; }
 #endif
 
-  uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
   gslc_DrvDrawPoint_base(nX, nY, nColRaw);
   return true;
 }
@@ -1547,7 +1557,30 @@ bool gslc_DrvDrawPoints(gslc_tsGui* pGui,gslc_tsPt* asPt,uint16_t nNumPt,gslc_ts
   return false;
 }
 
+bool gslc_DrvDrawSpans(gslc_tsGui* pGui,gslc_tsSpan* asSpan,uint16_t nSpanCnt,gslc_tsColorRaw nColRaw)
+{
+  (void)pGui; // Unused
+  (void)asSpan; // Unused
+  (void)nSpanCnt; // Unused
+  (void)nColRaw; // Unused
+  return false;
+}
+
+bool gslc_DrvCopyRect(gslc_tsGui* pGui,gslc_tsRect rSrc,int16_t nDstX,int16_t nDstY)
+{
+  (void)pGui; // Unused
+  (void)rSrc; // Unused
+  (void)nDstX; // Unused
+  (void)nDstY; // Unused
+  return false;
+}
+
 bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
+{
+  return gslc_DrvDrawFillRectRaw(pGui,rRect,gslc_DrvAdaptColorToRaw(nCol));
+}
+
+bool gslc_DrvDrawFillRectRaw(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColorRaw nColRaw)
 {
 #if (GSLC_CLIP_EN)
   // Perform clipping
@@ -1555,7 +1588,6 @@ bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
   if (!gslc_ClipRect(&pDriver->rClipRect,&rRect)) { return true; }
 #endif
 
-  uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
   #if defined(DRV_DISP_LCDGFX)
     NanoRect r;
     r.setRect(rRect.x,rRect.y,rRect.x+rRect.w-1,rRect.y+rRect.h-1);
@@ -1575,8 +1607,8 @@ bool gslc_DrvDrawFillRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadiu
 {
   (void)pGui; // Unused
 #if (DRV_HAS_DRAW_RECT_ROUND_FILL)
-  // TODO: Support GSLC_CLIP_EN
-  // - Would need to determine how to clip the rounded corners
+  // Clipping is performed by the core, which only calls the driver
+  // when the rounded rect lies entirely within the clipping region
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
   m_disp.fillRoundRect(rRect.x,rRect.y,rRect.w,rRect.h,nRadius,nColRaw);
 #else
@@ -1590,7 +1622,11 @@ bool gslc_DrvDrawFillRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadiu
 
 bool gslc_DrvDrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
 {
-  uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
+  return gslc_DrvDrawFrameRectRaw(pGui,rRect,gslc_DrvAdaptColorToRaw(nCol));
+}
+
+bool gslc_DrvDrawFrameRectRaw(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColorRaw nColRaw)
+{
 #if (GSLC_CLIP_EN)
   // Perform clipping
   // - TODO: Optimize the following, perhaps with new ClipLineHV()
@@ -1642,8 +1678,8 @@ bool gslc_DrvDrawFrameRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadi
 #if (DRV_HAS_DRAW_RECT_ROUND_FRAME)
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
 
-  // TODO: Support GSLC_CLIP_EN
-  // - Would need to determine how to clip the rounded corners
+  // Clipping is performed by the core, which only calls the driver
+  // when the rounded rect lies entirely within the clipping region
   m_disp.drawRoundRect(rRect.x,rRect.y,rRect.w,rRect.h,nRadius,nColRaw);
 #else
   (void)rRect; // Unused
@@ -1656,6 +1692,11 @@ bool gslc_DrvDrawFrameRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadi
 
 
 bool gslc_DrvDrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColor nCol)
+{
+  return gslc_DrvDrawLineRaw(pGui,nX0,nY0,nX1,nY1,gslc_DrvAdaptColorToRaw(nCol));
+}
+
+bool gslc_DrvDrawLineRaw(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColorRaw nColRaw)
 {
 #if (GSLC_CLIP_EN)
   gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
@@ -1664,7 +1705,6 @@ bool gslc_DrvDrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16
   (void)pGui; // Unused
 #endif
 
-  uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
   gslc_DrvDrawLine_base(nX0,nY0,nX1,nY1,nColRaw);
   return true;
 }
@@ -1672,9 +1712,7 @@ bool gslc_DrvDrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16
 bool gslc_DrvDrawFrameCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,uint16_t nRadius,gslc_tsColor nCol)
 {
   (void)pGui;
-#if (GSLC_CLIP_EN)
-  // TODO
-#endif
+  // Clipping is performed by the core (see gslc_ClipBound)
 
 #if (DRV_HAS_DRAW_CIRCLE_FRAME)
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
@@ -1691,9 +1729,7 @@ bool gslc_DrvDrawFrameCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,uint16
 bool gslc_DrvDrawFillCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,uint16_t nRadius,gslc_tsColor nCol)
 {
   (void)pGui; // Unused
-#if (GSLC_CLIP_EN)
-  // TODO
-#endif
+  // Clipping is performed by the core (see gslc_ClipBound)
 
 #if (DRV_HAS_DRAW_CIRCLE_FILL)
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
@@ -1714,9 +1750,7 @@ bool gslc_DrvDrawFrameTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
   (void)pGui; // Unused
 #if (DRV_HAS_DRAW_TRI_FRAME)
 
-#if (GSLC_CLIP_EN)
-  // TODO
-#endif
+  // Clipping is performed by the core (see gslc_ClipBound)
 
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
   m_disp.drawTriangle(nX0,nY0,nX1,nY1,nX2,nY2,nColRaw);
@@ -1736,9 +1770,7 @@ bool gslc_DrvDrawFillTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
   (void)pGui; // Unused
 #if (DRV_HAS_DRAW_TRI_FILL)
 
-#if (GSLC_CLIP_EN)
-  // TODO
-#endif
+  // Clipping is performed by the core (see gslc_ClipBound)
 
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
   m_disp.fillTriangle(nX0,nY0,nX1,nY1,nX2,nY2,nColRaw);
@@ -1796,15 +1828,23 @@ void gslc_DrvDrawMonoFromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,
   int16_t i, j, byteWidth = (w + 7) / 8;
   uint8_t nByte = 0;
 
-  for(j=0; j<h; j++) {
-    for(i=0; i<w; i++) {
-      if(i & 7) nByte <<= 1;
+  // Only visit the pixels that lie within the clipping region
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsRect rDraw = (gslc_tsRect){nDstX,nDstY,(uint16_t)w,(uint16_t)h};
+  if (!gslc_ClipRect(&pDriver->rClipRect,&rDraw)) { return; }
+  int16_t nCol0 = rDraw.x - nDstX;
+  int16_t nRow0 = rDraw.y - nDstY;
+
+  for(j=nRow0; j<nRow0+rDraw.h; j++) {
+    for(i=nCol0; i<nCol0+rDraw.w; i++) {
+      if((i & 7) && (i != nCol0)) nByte <<= 1;
       else {
         if (bProgMem) {
           nByte = pgm_read_byte(bmap_base + j * byteWidth + i / 8);
         } else {
           nByte = bmap_base[j * byteWidth + i / 8];
         }
+        nByte <<= (i & 7);
       }
       if(nByte & 0x80) {
         gslc_DrvDrawPoint(pGui,nDstX+i,nDstY+j,nCol);
@@ -1829,24 +1869,35 @@ void gslc_DrvDrawBmp24FromMem(gslc_tsGui* pGui,int16_t nDstX, int16_t nDstY,cons
   #if defined(DBG_DRIVER)
   GSLC_DEBUG_PRINT("DBG: DrvDrawBmp24FromMem() w=%d h=%d\n", w, h);
   #endif
+  // Only visit the pixels that lie within the clipping region
+  // - This limits the transfer during partial redraws (eg. when
+  //   repainting the exposed region of a background image)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsRect rDraw = (gslc_tsRect){nDstX,nDstY,(uint16_t)w,(uint16_t)h};
+  if (!gslc_ClipRect(&pDriver->rClipRect,&rDraw)) { return; }
   #if (DRV_HAS_DRAW_BMP_MEM)
-  if (!bProgMem) {
+  // The bulk transfer is only used if the entire image is visible
+  if ((!bProgMem) && (rDraw.w == w) && (rDraw.h == h)) {
     m_disp.drawRGBBitmap(nDstX, nDstY, (uint16_t*) pImage,w, h); 
     return;
   }
   #endif
   int row, col;
+  int nCol0 = rDraw.x - nDstX;
+  int nRow0 = rDraw.y - nDstY;
   uint16_t nColRaw;
-  for (row=0; row<h; row++) { // For each scanline...
-    for (col=0; col<w; col++) { // For each pixel...
+  const uint16_t* pPixel;
+  for (row=nRow0; row<nRow0+rDraw.h; row++) { // For each scanline...
+    pPixel = pImage + (row * w) + nCol0;
+    for (col=nCol0; col<nCol0+rDraw.w; col++) { // For each pixel...
 
       // Fetch the requested pixel value
       if (bProgMem) {
         // To read from Flash Memory, pgm_read_XXX is required.
         // Since image is stored as uint16_t, pgm_read_word is used as it uses 16bit address
-        nColRaw = pgm_read_word(pImage++);
+        nColRaw = pgm_read_word(pPixel++);
       } else {
-        nColRaw = *(pImage++);
+        nColRaw = *(pPixel++);
       }
 
       // If transparency is enabled, check to see if pixel should be masked
@@ -1957,15 +2008,24 @@ void gslc_DrvDrawBmp24FromSD(gslc_tsGui* pGui,const char *filename, uint16_t x,
         }
 
         // Crop area to be loaded
-        w = bmpWidth;
-        h = bmpHeight;
-        if((x+w-1) >= pGui->nDispW) w = pGui->nDispW  - x;
-        if((y+h-1) >= pGui->nDispH) h = pGui->nDispH - y;
+        // - Only the region within the clipping rect is read, so
+        //   that partial redraws (eg. of a background image) don't
+        //   need to transfer the entire image
+        gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+        gslc_tsRect rDraw = (gslc_tsRect){(int16_t)x,(int16_t)y,(uint16_t)bmpWidth,(uint16_t)bmpHeight};
+        if (!gslc_ClipRect(&pDriver->rClipRect,&rDraw)) {
+          bmpFile.close();
+          return;
+        }
+        int nCol0 = rDraw.x - x;
+        int nRow0 = rDraw.y - y;
+        w = nCol0 + rDraw.w;
+        h = nRow0 + rDraw.h;
 
         // Set TFT address window to clipped image bounds
         //xxx tft.setAddrWindow(x, y, x+w-1, y+h-1);
 
-        for (row=0; row<h; row++) { // For each scanline...
+        for (row=nRow0; row<h; row++) { // For each scanline...
 
           // Seek to start of scan line.  It might seem labor-
           // intensive to be doing this on every line, but this
@@ -1977,12 +2037,13 @@ void gslc_DrvDrawBmp24FromSD(gslc_tsGui* pGui,const char *filename, uint16_t x,
             pos = bmpImageoffset + (bmpHeight - 1 - row) * rowSize;
           else     // Bitmap is stored top-to-bottom
             pos = bmpImageoffset + row * rowSize;
+          pos += nCol0 * 3;
           if(bmpFile.position() != pos) { // Need seek?
             bmpFile.seek(pos);
             buffidx = sizeof(sdbuffer); // Force buffer reload
           }
 
-          for (col=0; col<w; col++) { // For each pixel...
+          for (col=nCol0; col<w; col++) { // For each pixel...
             // Time to read more pixel data?
             if (buffidx >= sizeof(sdbuffer)) { // Indeed
               bmpFile.read(sdbuffer, sizeof(sdbuffer));
@@ -2112,8 +2173,10 @@ void gslc_DrvDrawBkgnd(gslc_tsGui* pGui)
       //       that API doesn't support clipping. Since
       //       we may be redrawing the page with a clipping
       //       region enabled, it is important that we don't
-      //       redraw the entire screen.
-      gslc_tsRect rRect = (gslc_tsRect) { 0, 0, pGui->nDispW, pGui->nDispH };
+      //       redraw the entire screen. Only the region within
+      //       the clipping rect is filled (even if GSLC_CLIP_EN
+      //       is disabled).
+      gslc_tsRect rRect = pDriver->rClipRect;
       gslc_DrvDrawFillRect(pGui, rRect, pDriver->nColBkgnd);
     } else {
       // An image should be loaded
@@ -2155,6 +2218,12 @@ void* gslc_DrvGetDriverTouch(gslc_tsGui* pGui)
   #endif
 }
 
+uint32_t gslc_DrvGetTimeMs(gslc_tsGui* pGui)
+{
+  (void)pGui; // Unused
+  return millis();
+}
+
 
 bool gslc_DrvGetTouch(gslc_tsGui* pGui,int16_t* pnX,int16_t* pnY,uint16_t* pnPress,gslc_teInputRawEvent* peInputEvent,int16_t* pnInputVal)
 {
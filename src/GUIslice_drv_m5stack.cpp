@@ -184,7 +184,7 @@ bool gslc_DrvSetElemImageNorm(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef
 {
   // This driver doesn't preload the image to memory,
   // so we just save the reference for loading upon render
-  pElem->sImgRefNorm = sImgRef;
+  GSLC_ELEM_ATTR(pElem)->sImgRefNorm = sImgRef;
   return true; // TODO
 }
 
@@ -193,7 +193,7 @@ bool gslc_DrvSetElemImageGlow(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef
 {
   // This driver doesn't preload the image to memory,
   // so we just save the reference for loading upon render
-  pElem->sImgRefGlow = sImgRef;
+  GSLC_ELEM_ATTR(pElem)->sImgRefGlow = sImgRef;
   return true; // TODO
 }
 
@@ -204,9 +204,8 @@ void gslc_DrvImageDestruct(void* pvImg)
 
 bool gslc_DrvSetClipRect(gslc_tsGui* pGui,gslc_tsRect* pRect)
 {
-  // NOTE: The clipping rect is currently saved in the
-  // driver struct, but the drawing code does not currently
-  // use it.
+  // NOTE: The clipping rect is saved in the driver struct. The core
+  // uses it to clip primitives before they are passed to the driver.
   gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
   if (pRect == NULL) {
     // Default to entire display
@@ -378,7 +377,19 @@ inline void gslc_DrvDrawLine_base(int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY
 }
 
 
+gslc_tsColorRaw gslc_DrvColorToRaw(gslc_tsGui* pGui,gslc_tsColor nCol)
+{
+  (void)pGui; // Unused
+  return gslc_DrvAdaptColorToRaw(nCol);
+}
+
+
 bool gslc_DrvDrawPoint(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol)
+{
+  return gslc_DrvDrawPointRaw(pGui,nX,nY,gslc_DrvAdaptColorToRaw(nCol));
+}
+
+bool gslc_DrvDrawPointRaw(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColorRaw nColRaw)
 {
 #if (GSLC_CLIP_EN)
   // Perform clipping
@@ -386,7 +397,6 @@ bool gslc_DrvDrawPoint(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol)
   if (!gslc_ClipPt(&pDriver->rClipRect,nX,nY)) { return true; }
 #endif
 
-  uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
   gslc_DrvDrawPoint_base(nX, nY, nColRaw);
   return true;
 }
@@ -397,7 +407,30 @@ bool gslc_DrvDrawPoints(gslc_tsGui* pGui,gslc_tsPt* asPt,uint16_t nNumPt,gslc_ts
   return false;
 }
 
+bool gslc_DrvDrawSpans(gslc_tsGui* pGui,gslc_tsSpan* asSpan,uint16_t nSpanCnt,gslc_tsColorRaw nColRaw)
+{
+  (void)pGui; // Unused
+  (void)asSpan; // Unused
+  (void)nSpanCnt; // Unused
+  (void)nColRaw; // Unused
+  return false;
+}
+
+bool gslc_DrvCopyRect(gslc_tsGui* pGui,gslc_tsRect rSrc,int16_t nDstX,int16_t nDstY)
+{
+  (void)pGui; // Unused
+  (void)rSrc; // Unused
+  (void)nDstX; // Unused
+  (void)nDstY; // Unused
+  return false;
+}
+
 bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
+{
+  return gslc_DrvDrawFillRectRaw(pGui,rRect,gslc_DrvAdaptColorToRaw(nCol));
+}
+
+bool gslc_DrvDrawFillRectRaw(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColorRaw nColRaw)
 {
 #if (GSLC_CLIP_EN)
   // Perform clipping
@@ -405,7 +438,6 @@ bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
   if (!gslc_ClipRect(&pDriver->rClipRect,&rRect)) { return true; }
 #endif
 
-  uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
   m_disp.fillRect(rRect.x,rRect.y,rRect.w,rRect.h,nColRaw);
   return true;
 }
@@ -413,8 +445,8 @@ bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
 bool gslc_DrvDrawFillRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadius,gslc_tsColor nCol)
 {
 #if (DRV_HAS_DRAW_RECT_ROUND_FILL)
-  // TODO: Support GSLC_CLIP_EN
-  // - Would need to determine how to clip the rounded corners
+  // Clipping is performed by the core, which only calls the driver
+  // when the rounded rect lies entirely within the clipping region
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
   m_disp.fillRoundRect(rRect.x,rRect.y,rRect.w,rRect.h,nRadius,nColRaw);
 #endif
@@ -424,7 +456,11 @@ bool gslc_DrvDrawFillRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadiu
 
 bool gslc_DrvDrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
 {
-  uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
+  return gslc_DrvDrawFrameRectRaw(pGui,rRect,gslc_DrvAdaptColorToRaw(nCol));
+}
+
+bool gslc_DrvDrawFrameRectRaw(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColorRaw nColRaw)
+{
 #if (GSLC_CLIP_EN)
   // Perform clipping
   // - TODO: Optimize the following, perhaps with new ClipLineHV()
@@ -465,8 +501,8 @@ bool gslc_DrvDrawFrameRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadi
 #if (DRV_HAS_DRAW_RECT_ROUND_FRAME)
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
 
-  // TODO: Support GSLC_CLIP_EN
-  // - Would need to determine how to clip the rounded corners
+  // Clipping is performed by the core, which only calls the driver
+  // when the rounded rect lies entirely within the clipping region
   m_disp.drawRoundRect(rRect.x,rRect.y,rRect.w,rRect.h,nRadius,nColRaw);
 #endif
   return true;
@@ -475,22 +511,24 @@ bool gslc_DrvDrawFrameRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadi
 
 
 bool gslc_DrvDrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColor nCol)
+{
+  return gslc_DrvDrawLineRaw(pGui,nX0,nY0,nX1,nY1,gslc_DrvAdaptColorToRaw(nCol));
+}
+
+bool gslc_DrvDrawLineRaw(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColorRaw nColRaw)
 {
 #if (GSLC_CLIP_EN)
   gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
   if (!gslc_ClipLine(&pDriver->rClipRect,&nX0,&nY0,&nX1,&nY1)) { return true; }
 #endif
 
-  uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
   gslc_DrvDrawLine_base(nX0,nY0,nX1,nY1,nColRaw);
   return true;
 }
 
 bool gslc_DrvDrawFrameCircle(gslc_tsGui*,int16_t nMidX,int16_t nMidY,uint16_t nRadius,gslc_tsColor nCol)
 {
-#if (GSLC_CLIP_EN)
-  // TODO
-#endif
+  // Clipping is performed by the core (see gslc_ClipBound)
 
 #if (DRV_HAS_DRAW_CIRCLE_FRAME)
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
@@ -501,9 +539,7 @@ bool gslc_DrvDrawFrameCircle(gslc_tsGui*,int16_t nMidX,int16_t nMidY,uint16_t nR
 
 bool gslc_DrvDrawFillCircle(gslc_tsGui*,int16_t nMidX,int16_t nMidY,uint16_t nRadius,gslc_tsColor nCol)
 {
-#if (GSLC_CLIP_EN)
-  // TODO
-#endif
+  // Clipping is performed by the core (see gslc_ClipBound)
 
 #if (DRV_HAS_DRAW_CIRCLE_FILL)
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
@@ -518,9 +554,7 @@ bool gslc_DrvDrawFrameTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
 {
 #if (DRV_HAS_DRAW_TRI_FRAME)
 
-#if (GSLC_CLIP_EN)
-  // TODO
-#endif
+  // Clipping is performed by the core (see gslc_ClipBound)
 
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
   m_disp.drawTriangle(nX0,nY0,nX1,nY1,nX2,nY2,nColRaw);
@@ -533,9 +567,7 @@ bool gslc_DrvDrawFillTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
 {
 #if (DRV_HAS_DRAW_TRI_FILL)
 
-#if (GSLC_CLIP_EN)
-  // TODO
-#endif
+  // Clipping is performed by the core (see gslc_ClipBound)
 
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
   m_disp.fillTriangle(nX0,nY0,nX1,nY1,nX2,nY2,nColRaw);
@@ -914,6 +946,12 @@ void* gslc_DrvGetDriverTouch(gslc_tsGui* pGui)
   #endif
 }
 
+uint32_t gslc_DrvGetTimeMs(gslc_tsGui* pGui)
+{
+  (void)pGui; // Unused
+  return millis();
+}
+
 bool gslc_DrvGetTouch(gslc_tsGui* pGui,int16_t* pnX,int16_t* pnY,uint16_t* pnPress,gslc_teInputRawEvent* peInputEvent,int16_t* pnInputVal)
 {
 
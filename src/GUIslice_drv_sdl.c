@@ -43,6 +43,7 @@
 #include "GUIslice_drv_sdl.h"
 
 #include <stdio.h>
+#include <string.h>     // For memmove()
 
 // ------------------------------------------------------------------------
 // Load display & touch drivers
@@ -239,6 +240,9 @@ bool gslc_DrvInit(gslc_tsGui* pGui)
   SDL_ShowCursor(SDL_DISABLE);
   #endif
 
+  // Default the clipping region to the entire display
+  gslc_DrvSetClipRect(pGui,NULL);
+
   return true;
 }
 
@@ -456,14 +460,14 @@ bool gslc_DrvSetBkgndColor(gslc_tsGui* pGui,gslc_tsColor nCol)
 bool gslc_DrvSetElemImageNorm(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef sImgRef)
 {
   // Dispose of previous image
-  if (pElem->sImgRefNorm.eImgFlags != GSLC_IMGREF_NONE) {
-    gslc_DrvImageDestruct(pElem->sImgRefNorm.pvImgRaw);
-    pElem->sImgRefNorm = gslc_ResetImage();
+  if (GSLC_ELEM_ATTR(pElem)->sImgRefNorm.eImgFlags != GSLC_IMGREF_NONE) {
+    gslc_DrvImageDestruct(GSLC_ELEM_ATTR(pElem)->sImgRefNorm.pvImgRaw);
+    GSLC_ELEM_ATTR(pElem)->sImgRefNorm = gslc_ResetImage();
   }
 
-  pElem->sImgRefNorm = sImgRef;
-  pElem->sImgRefNorm.pvImgRaw = gslc_DrvLoadImage(pGui,sImgRef);
-  if (pElem->sImgRefNorm.pvImgRaw == NULL) {
+  GSLC_ELEM_ATTR(pElem)->sImgRefNorm = sImgRef;
+  GSLC_ELEM_ATTR(pElem)->sImgRefNorm.pvImgRaw = gslc_DrvLoadImage(pGui,sImgRef);
+  if (GSLC_ELEM_ATTR(pElem)->sImgRefNorm.pvImgRaw == NULL) {
     GSLC_DEBUG2_PRINT("ERROR: DrvSetElemImageNorm(%s) failed\n","");
     return false;
   }
@@ -474,14 +478,14 @@ bool gslc_DrvSetElemImageNorm(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef
 bool gslc_DrvSetElemImageGlow(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef sImgRef)
 {
   // Dispose of previous image
-  if (pElem->sImgRefGlow.eImgFlags != GSLC_IMGREF_NONE) {
-    gslc_DrvImageDestruct(pElem->sImgRefGlow.pvImgRaw);
-    pElem->sImgRefGlow = gslc_ResetImage();
+  if (GSLC_ELEM_ATTR(pElem)->sImgRefGlow.eImgFlags != GSLC_IMGREF_NONE) {
+    gslc_DrvImageDestruct(GSLC_ELEM_ATTR(pElem)->sImgRefGlow.pvImgRaw);
+    GSLC_ELEM_ATTR(pElem)->sImgRefGlow = gslc_ResetImage();
   }
 
-  pElem->sImgRefGlow = sImgRef;
-  pElem->sImgRefGlow.pvImgRaw = gslc_DrvLoadImage(pGui,sImgRef);
-  if (pElem->sImgRefGlow.pvImgRaw == NULL) {
+  GSLC_ELEM_ATTR(pElem)->sImgRefGlow = sImgRef;
+  GSLC_ELEM_ATTR(pElem)->sImgRefGlow.pvImgRaw = gslc_DrvLoadImage(pGui,sImgRef);
+  if (GSLC_ELEM_ATTR(pElem)->sImgRefGlow.pvImgRaw == NULL) {
     GSLC_DEBUG2_PRINT("ERROR: DrvSetElemImageGlow(%s) failed\n","");
     return false;
   }
@@ -505,6 +509,13 @@ void gslc_DrvImageDestruct(void* pvImg)
 bool gslc_DrvSetClipRect(gslc_tsGui* pGui,gslc_tsRect* pRect)
 {
   gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (pRect == NULL) {
+    // Default to entire display
+    pDriver->rClipRect = (gslc_tsRect){0,0,pGui->nDispW,pGui->nDispH};
+  } else {
+    pDriver->rClipRect = *pRect;
+  }
+
 #if defined(DRV_DISP_SDL1)
   SDL_Surface*  pScreen = pDriver->pSurfScreen;
   if (pRect == NULL) {
@@ -672,17 +683,74 @@ void gslc_DrvPageFlipNow(gslc_tsGui* pGui)
 #endif
 }
 
+void gslc_DrvPageFlipRect(gslc_tsGui* pGui,gslc_tsRect* asRect,uint8_t nRectCnt)
+{
+#if defined(DRV_DISP_SDL1)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  SDL_Surface*   pScreen = pDriver->pSurfScreen;
+  SDL_Rect       asRectSdl[GSLC_INVALIDATE_RECT_MAX];
+  gslc_tsRect    rScreen = (gslc_tsRect) { 0, 0, pGui->nDispW, pGui->nDispH };
+  gslc_tsRect    rUpdate;
+  int            nRectSdlCnt = 0;
+  uint8_t        nInd;
+
+  if (nRectCnt > GSLC_INVALIDATE_RECT_MAX) {
+    // Too many regions to track, so update the entire screen
+    SDL_Flip(pScreen);
+    return;
+  }
+  // SDL_UpdateRects() requires that the regions lie within the screen
+  for (nInd = 0; nInd < nRectCnt; nInd++) {
+    rUpdate = asRect[nInd];
+    if (!gslc_ClipRect(&rScreen,&rUpdate)) {
+      continue;
+    }
+    asRectSdl[nRectSdlCnt].x = rUpdate.x;
+    asRectSdl[nRectSdlCnt].y = rUpdate.y;
+    asRectSdl[nRectSdlCnt].w = rUpdate.w;
+    asRectSdl[nRectSdlCnt].h = rUpdate.h;
+    nRectSdlCnt++;
+  }
+  if (nRectSdlCnt > 0) {
+    SDL_UpdateRects(pScreen,nRectSdlCnt,asRectSdl);
+  }
+#else
+  // Partial updates aren't supported by the renderer
+  (void)asRect;
+  (void)nRectCnt;
+  gslc_DrvPageFlipNow(pGui);
+#endif
+}
+
 
 // -----------------------------------------------------------------------
 // Graphics Primitives Functions
 // -----------------------------------------------------------------------
 
 
+gslc_tsColorRaw gslc_DrvColorToRaw(gslc_tsGui* pGui,gslc_tsColor nCol)
+{
+#if defined(DRV_DISP_SDL1)
+  return gslc_DrvAdaptColorRaw(pGui,nCol);
+#endif
+#if defined(DRV_DISP_SDL2)
+  // The renderer takes RGB components, so simply pack them
+  (void)pGui; // Unused
+  return ((gslc_tsColorRaw)nCol.r << 16) | ((gslc_tsColorRaw)nCol.g << 8) | nCol.b;
+#endif
+}
+
+
 bool gslc_DrvDrawPoint(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol)
+{
+  return gslc_DrvDrawPointRaw(pGui,nX,nY,gslc_DrvColorToRaw(pGui,nCol));
+}
+
+
+bool gslc_DrvDrawPointRaw(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColorRaw nColRaw)
 {
 #if defined(DRV_DISP_SDL1)
   if (gslc_DrvScreenLock(pGui)) {
-    uint32_t nColRaw = gslc_DrvAdaptColorRaw(pGui,nCol);
     gslc_DrvDrawSetPixelRaw(pGui,nX,nY,nColRaw);
     gslc_DrvScreenUnlock(pGui);
   }
@@ -690,7 +758,7 @@ bool gslc_DrvDrawPoint(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol)
 #if defined(DRV_DISP_SDL2)
   gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
   SDL_Renderer*  pRender = pDriver->pRender;
-  SDL_SetRenderDrawColor(pRender,nCol.r,nCol.g,nCol.b,255);
+  gslc_DrvSetRenderColorRaw(pRender,nColRaw);
 
   // Call SDL optimized routine
   SDL_RenderDrawPoint(pRender,nX,nY);
@@ -725,7 +793,92 @@ bool gslc_DrvDrawPoints(gslc_tsGui* pGui,gslc_tsPt* asPt,uint16_t nNumPt,gslc_ts
   return true;
 }
 
+bool gslc_DrvDrawSpans(gslc_tsGui* pGui,gslc_tsSpan* asSpan,uint16_t nSpanCnt,gslc_tsColorRaw nColRaw)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  uint16_t nSpanInd;
+#if defined(DRV_DISP_SDL1)
+  SDL_Surface*  pScreen = pDriver->pSurfScreen;
+  SDL_Rect      rSRect;
+  for (nSpanInd=0;nSpanInd<nSpanCnt;nSpanInd++) {
+    rSRect.x = asSpan[nSpanInd].nX;
+    rSRect.y = asSpan[nSpanInd].nY;
+    rSRect.w = asSpan[nSpanInd].nW;
+    rSRect.h = 1;
+    // Call SDL optimized routine
+    SDL_FillRect(pScreen,&rSRect,nColRaw);
+  }
+#endif
+#if defined(DRV_DISP_SDL2)
+  SDL_Renderer* pRender = pDriver->pRender;
+  SDL_Rect      arRectSdl[GSLC_SPAN_BUF_MAX];
+  if (nSpanCnt > GSLC_SPAN_BUF_MAX) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvDrawSpans() count (%u) exceeds GSLC_SPAN_BUF_MAX\n",nSpanCnt);
+    return false;
+  }
+  for (nSpanInd=0;nSpanInd<nSpanCnt;nSpanInd++) {
+    arRectSdl[nSpanInd].x = asSpan[nSpanInd].nX;
+    arRectSdl[nSpanInd].y = asSpan[nSpanInd].nY;
+    arRectSdl[nSpanInd].w = asSpan[nSpanInd].nW;
+    arRectSdl[nSpanInd].h = 1;
+  }
+  gslc_DrvSetRenderColorRaw(pRender,nColRaw);
+
+  // Call SDL optimized routine
+  SDL_RenderFillRects(pRender,arRectSdl,(int)nSpanCnt);
+#endif
+  return true;
+}
+
+bool gslc_DrvCopyRect(gslc_tsGui* pGui,gslc_tsRect rSrc,int16_t nDstX,int16_t nDstY)
+{
+#if defined(DRV_DISP_SDL1)
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  SDL_Surface*    pScreen = pDriver->pSurfScreen;
+  // SDL_BlitSurface() doesn't support overlapping source and
+  // destination regions within the same surface, so move the
+  // rows directly, ordering them so that no source row is
+  // overwritten before it has been copied
+  int             nBpp = pScreen->format->BytesPerPixel;
+  int             nPitch = pScreen->pitch;
+  size_t          nRowBytes = (size_t)rSrc.w * nBpp;
+  int16_t         nRow,nRowY;
+  uint8_t*        pPixels;
+  if ((rSrc.x < 0) || (rSrc.y < 0) || (nDstX < 0) || (nDstY < 0) ||
+      (rSrc.x + (int)rSrc.w > pScreen->w) || (nDstX + (int)rSrc.w > pScreen->w) ||
+      (rSrc.y + (int)rSrc.h > pScreen->h) || (nDstY + (int)rSrc.h > pScreen->h)) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvCopyRect() region outside of screen%s\n","");
+    return false;
+  }
+  if (!gslc_DrvScreenLock(pGui)) {
+    return false;
+  }
+  pPixels = (uint8_t*)pScreen->pixels;
+  for (nRow=0;nRow<(int16_t)rSrc.h;nRow++) {
+    nRowY = (nDstY > rSrc.y)? (int16_t)(rSrc.h-1-nRow) : nRow;
+    memmove(pPixels + (nDstY+nRowY)*nPitch + nDstX*nBpp,
+            pPixels + (rSrc.y+nRowY)*nPitch + rSrc.x*nBpp,nRowBytes);
+  }
+  gslc_DrvScreenUnlock(pGui);
+  return true;
+#else
+  // The renderer draws straight to the window, whose contents
+  // are not retained across page flips, so there is nothing to
+  // copy from
+  (void)pGui; // Unused
+  (void)rSrc; // Unused
+  (void)nDstX; // Unused
+  (void)nDstY; // Unused
+  return false;
+#endif
+}
+
 bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
+{
+  return gslc_DrvDrawFillRectRaw(pGui,rRect,gslc_DrvColorToRaw(pGui,nCol));
+}
+
+bool gslc_DrvDrawFillRectRaw(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColorRaw nColRaw)
 {
   gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
 #if defined(DRV_DISP_SDL1)
@@ -734,12 +887,11 @@ bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
   SDL_Surface*  pScreen = pDriver->pSurfScreen;
 
   // Call SDL optimized routine
-  SDL_FillRect(pScreen,&rSRect,
-    SDL_MapRGB(pScreen->format,nCol.r,nCol.g,nCol.b));
+  SDL_FillRect(pScreen,&rSRect,nColRaw);
 #endif
 #if defined(DRV_DISP_SDL2)
   SDL_Renderer* pRender = pDriver->pRender;
-  SDL_SetRenderDrawColor(pRender,nCol.r,nCol.g,nCol.b,255);
+  gslc_DrvSetRenderColorRaw(pRender,nColRaw);
 
   // Call SDL optimized routine
   SDL_Rect  rRectSdl;
@@ -750,6 +902,11 @@ bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
 }
 
 bool gslc_DrvDrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
+{
+  return gslc_DrvDrawFrameRectRaw(pGui,rRect,gslc_DrvColorToRaw(pGui,nCol));
+}
+
+bool gslc_DrvDrawFrameRectRaw(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColorRaw nColRaw)
 {
 #if defined(DRV_DISP_SDL1)
   return false;
@@ -757,7 +914,7 @@ bool gslc_DrvDrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
 #if defined(DRV_DISP_SDL2)
   gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
   SDL_Renderer* pRender  = pDriver->pRender;
-  SDL_SetRenderDrawColor(pRender,nCol.r,nCol.g,nCol.b,255);
+  gslc_DrvSetRenderColorRaw(pRender,nColRaw);
 
   // Call SDL optimized routine
   SDL_Rect  rRectSdl;
@@ -774,10 +931,21 @@ bool gslc_DrvDrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16
   // ERROR
   return false;
 #endif
+#if defined(DRV_DISP_SDL2)
+  return gslc_DrvDrawLineRaw(pGui,nX0,nY0,nX1,nY1,gslc_DrvColorToRaw(pGui,nCol));
+#endif
+}
+
+bool gslc_DrvDrawLineRaw(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColorRaw nColRaw)
+{
+#if defined(DRV_DISP_SDL1)
+  // ERROR
+  return false;
+#endif
 #if defined(DRV_DISP_SDL2)
   gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
   SDL_Renderer* pRender  = pDriver->pRender;
-  SDL_SetRenderDrawColor(pRender,nCol.r,nCol.g,nCol.b,255);
+  gslc_DrvSetRenderColorRaw(pRender,nColRaw);
 
   // Call SDL optimized routine
   SDL_RenderDrawLine(pRender,nX0,nY0,nX1,nY1);
@@ -846,7 +1014,12 @@ void gslc_DrvDrawBkgnd(gslc_tsGui* pGui)
   gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
 
 #if defined(DRV_DISP_SDL1)
-  gslc_DrvPasteSurface(pGui,0,0,pGui->sImgRefBkgnd.pvImgRaw,pDriver->pSurfScreen);
+  // Only blit the portion of the background that lies within
+  // the clipping region, so that partial redraws (eg. after
+  // hiding an element) don't copy the entire background
+  SDL_Rect  rSrc = gslc_DrvAdaptRect(pDriver->rClipRect);
+  SDL_Rect  rDest = rSrc;
+  SDL_BlitSurface((SDL_Surface*)(pImage),&rSrc,pDriver->pSurfScreen,&rDest);
 #endif
 
 #if defined(DRV_DISP_SDL2)
@@ -905,6 +1078,12 @@ void* gslc_DrvGetDriverTouch(gslc_tsGui* pGui)
   return NULL;
 }
 
+uint32_t gslc_DrvGetTimeMs(gslc_tsGui* pGui)
+{
+  (void)pGui; // Unused
+  return SDL_GetTicks();
+}
+
 
 bool gslc_DrvGetTouch(gslc_tsGui* pGui,int16_t* pnX,int16_t* pnY,uint16_t* pnPress,gslc_teInputRawEvent* peInputEvent,int16_t* pnInputVal)
 {
@@ -1214,6 +1393,14 @@ SDL_Color  gslc_DrvAdaptColor(gslc_tsColor sCol)
 // -----------------------------------------------------------------------
 
 
+#if defined(DRV_DISP_SDL2)
+void gslc_DrvSetRenderColorRaw(SDL_Renderer* pRender,gslc_tsColorRaw nColRaw)
+{
+  SDL_SetRenderDrawColor(pRender,(nColRaw >> 16) & 0xFF,(nColRaw >> 8) & 0xFF,nColRaw & 0xFF,255);
+}
+#endif
+
+
 #if defined(DRV_DISP_SDL1)
 uint32_t gslc_DrvAdaptColorRaw(gslc_tsGui* pGui,gslc_tsColor nCol)
 {
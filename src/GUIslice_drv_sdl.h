@@ -75,6 +75,7 @@ extern "C" {
 
 #if defined(DRV_DISP_SDL1)
   #define DRV_HAS_DRAW_POINTS            1 ///< Support gslc_DrvDrawPoints()
+  #define DRV_HAS_DRAW_SPANS             1 ///< Support gslc_DrvDrawSpans()
   #define DRV_HAS_DRAW_LINE              0 ///< Support gslc_DrvDrawLine()
   #define DRV_HAS_DRAW_RECT_FRAME        0 ///< Support gslc_DrvDrawFrameRect()
   #define DRV_HAS_DRAW_RECT_FILL         1 ///< Support gslc_DrvDrawFillRect()
@@ -86,10 +87,13 @@ extern "C" {
   #define DRV_HAS_DRAW_TRI_FILL          0 ///< Support gslc_DrvDrawFillTriangle()
   #define DRV_HAS_DRAW_TEXT              1 ///< Support gslc_DrvDrawTxt()
   #define DRV_HAS_DRAW_BMP_MEM           0 ///< Support gslc_DrvDrawBmp24FromMem()
+  #define DRV_HAS_PAGE_FLIP_RECT         1 ///< Support gslc_DrvPageFlipRect()
+  #define DRV_HAS_COPY_RECT              1 ///< Support gslc_DrvCopyRect()
 #endif
 
 #if defined(DRV_DISP_SDL2)
   #define DRV_HAS_DRAW_POINTS            1 ///< Support gslc_DrvDrawPoints()
+  #define DRV_HAS_DRAW_SPANS             1 ///< Support gslc_DrvDrawSpans()
   #define DRV_HAS_DRAW_LINE              1 ///< Support gslc_DrvDrawLine()
   #define DRV_HAS_DRAW_RECT_FRAME        1 ///< Support gslc_DrvDrawFrameRect()
   #define DRV_HAS_DRAW_RECT_FILL         1 ///< Support gslc_DrvDrawFillRect()
@@ -101,6 +105,8 @@ extern "C" {
   #define DRV_HAS_DRAW_TRI_FILL          0 ///< Support gslc_DrvDrawFillTriangle()
   #define DRV_HAS_DRAW_TEXT              1 ///< Support gslc_DrvDrawTxt()
   #define DRV_HAS_DRAW_BMP_MEM           0 ///< Support gslc_DrvDrawBmp24FromMem()
+  #define DRV_HAS_PAGE_FLIP_RECT         0 ///< Support gslc_DrvPageFlipRect()
+  #define DRV_HAS_COPY_RECT              0 ///< Support gslc_DrvCopyRect()
 #endif
 
 #define DRV_OVERRIDE_TXT_ALIGN      0 ///< Driver provides text alignment
@@ -217,6 +223,17 @@ void* gslc_DrvGetDriverDisp(gslc_tsGui* pGui);
 ///
 void* gslc_DrvGetDriverTouch(gslc_tsGui* pGui);
 
+///
+/// Get the current time from the platform's millisecond clock
+/// - This is used by the core for frame pacing
+/// - The value is free-running and is expected to wrap
+///
+/// \param[in]  pGui:      Pointer to GUI
+///
+/// \return Time in milliseconds
+///
+uint32_t gslc_DrvGetTimeMs(gslc_tsGui* pGui);
+
 
 // -----------------------------------------------------------------------
 // Image/surface handling Functions
@@ -377,11 +394,35 @@ bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* p
 ///
 void gslc_DrvPageFlipNow(gslc_tsGui* pGui);
 
+///
+/// Update the display with the contents of the specified
+/// regions of the active screen surface
+/// - Only supported by drivers that report DRV_HAS_PAGE_FLIP_RECT
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  asRect:      Array of rect regions to update
+/// \param[in]  nRectCnt:    Number of rect regions in asRect
+///
+/// \return none
+///
+void gslc_DrvPageFlipRect(gslc_tsGui* pGui,gslc_tsRect* asRect,uint8_t nRectCnt);
+
 
 // -----------------------------------------------------------------------
 // Graphics Primitives Functions
 // -----------------------------------------------------------------------
 
+///
+/// Convert a color to the native format used by the gslc_DrvDraw*Raw()
+/// primitives
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nCol:        Color RGB value to convert
+///
+/// \return Native color value
+///
+gslc_tsColorRaw gslc_DrvColorToRaw(gslc_tsGui* pGui,gslc_tsColor nCol);
+
 ///
 /// Draw a point
 ///
@@ -394,6 +435,18 @@ void gslc_DrvPageFlipNow(gslc_tsGui* pGui);
 ///
 bool gslc_DrvDrawPoint(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol);
 
+///
+/// Draw a point using a native color
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX:          X coordinate of point
+/// \param[in]  nY:          Y coordinate of point
+/// \param[in]  nColRaw:     Native color value from gslc_DrvColorToRaw()
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawPointRaw(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColorRaw nColRaw);
+
 ///
 /// Draw a point
 ///
@@ -406,6 +459,32 @@ bool gslc_DrvDrawPoint(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol)
 ///
 bool gslc_DrvDrawPoints(gslc_tsGui* pGui,gslc_tsPt* asPt,uint16_t nNumPt,gslc_tsColor nCol);
 
+///
+/// Draw a set of horizontal spans of a single color
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  asSpan:      Array of spans to draw
+/// \param[in]  nSpanCnt:    Number of spans in array
+/// \param[in]  nColRaw:     Native color value from gslc_DrvColorToRaw()
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawSpans(gslc_tsGui* pGui,gslc_tsSpan* asSpan,uint16_t nSpanCnt,gslc_tsColorRaw nColRaw);
+
+///
+/// Copy a rectangular region of the display to another position
+/// - The source and destination regions may overlap
+/// - Only supported by drivers that report DRV_HAS_COPY_RECT
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rSrc:        Rectangular region to copy
+/// \param[in]  nDstX:       X coordinate of destination top-left corner
+/// \param[in]  nDstY:       Y coordinate of destination top-left corner
+///
+/// \return true if the region was copied, false if not supported
+///
+bool gslc_DrvCopyRect(gslc_tsGui* pGui,gslc_tsRect rSrc,int16_t nDstX,int16_t nDstY);
+
 ///
 /// Draw a framed rectangle
 ///
@@ -417,6 +496,17 @@ bool gslc_DrvDrawPoints(gslc_tsGui* pGui,gslc_tsPt* asPt,uint16_t nNumPt,gslc_ts
 ///
 bool gslc_DrvDrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol);
 
+///
+/// Draw a framed rectangle using a native color
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Rectangular region to frame
+/// \param[in]  nColRaw:     Native color value from gslc_DrvColorToRaw()
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawFrameRectRaw(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColorRaw nColRaw);
+
 
 ///
 /// Draw a filled rectangle
@@ -429,6 +519,17 @@ bool gslc_DrvDrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
 ///
 bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol);
 
+///
+/// Draw a filled rectangle using a native color
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Rectangular region to fill
+/// \param[in]  nColRaw:     Native color value from gslc_DrvColorToRaw()
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawFillRectRaw(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColorRaw nColRaw);
+
 
 ///
 /// Draw a line
@@ -444,6 +545,20 @@ bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol);
 ///
 bool gslc_DrvDrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColor nCol);
 
+///
+/// Draw a line using a native color
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX0:         Line start (X coordinate)
+/// \param[in]  nY0:         Line start (Y coordinate)
+/// \param[in]  nX1:         Line finish (X coordinate)
+/// \param[in]  nY1:         Line finish (Y coordinate)
+/// \param[in]  nColRaw:     Native color value from gslc_DrvColorToRaw()
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawLineRaw(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColorRaw nColRaw);
+
 
 // TODO: Add DrvDrawFrameCircle()
 // TODO: Add DrvDrawFillCircle()
@@ -666,6 +781,18 @@ void gslc_DrvPasteSurface(gslc_tsGui* pGui,int16_t nX, int16_t nY, void* pvSrc,
 
 #endif // DRV_DISP_SDL1
 
+#if defined(DRV_DISP_SDL2)
+///
+/// Set the renderer draw color from a native color value
+///
+/// \param[in]  pRender:     Pointer to SDL renderer
+/// \param[in]  nColRaw:     Native color value from gslc_DrvColorToRaw()
+///
+/// \return none
+///
+void gslc_DrvSetRenderColorRaw(SDL_Renderer* pRender,gslc_tsColorRaw nColRaw);
+#endif // DRV_DISP_SDL2
+
 
 
 // -----------------------------------------------------------------------
@@ -308,7 +308,7 @@ bool gslc_DrvSetElemImageNorm(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef
 {
   // This driver doesn't preload the image to memory,
   // so we just save the reference for loading upon render
-  pElem->sImgRefNorm = sImgRef;
+  GSLC_ELEM_ATTR(pElem)->sImgRefNorm = sImgRef;
   return true; // TODO
 }
 
@@ -317,7 +317,7 @@ bool gslc_DrvSetElemImageGlow(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef
 {
   // This driver doesn't preload the image to memory,
   // so we just save the reference for loading upon render
-  pElem->sImgRefGlow = sImgRef;
+  GSLC_ELEM_ATTR(pElem)->sImgRefGlow = sImgRef;
   return true; // TODO
 }
 
@@ -328,9 +328,8 @@ void gslc_DrvImageDestruct(void* pvImg)
 
 bool gslc_DrvSetClipRect(gslc_tsGui* pGui,gslc_tsRect* pRect)
 {
-  // NOTE: The clipping rect is currently saved in the
-  // driver struct, but the drawing code does not currently
-  // use it.
+  // NOTE: The clipping rect is saved in the driver struct. The core
+  // uses it to clip primitives before they are passed to the driver.
   gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
   if (pRect == NULL) {
     // Default to entire display
@@ -557,7 +556,19 @@ inline void gslc_DrvDrawLine_base(int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY
 }
 
 
+gslc_tsColorRaw gslc_DrvColorToRaw(gslc_tsGui* pGui,gslc_tsColor nCol)
+{
+  (void)pGui; // Unused
+  return gslc_DrvAdaptColorToRaw(nCol);
+}
+
+
 bool gslc_DrvDrawPoint(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol)
+{
+  return gslc_DrvDrawPointRaw(pGui,nX,nY,gslc_DrvAdaptColorToRaw(nCol));
+}
+
+bool gslc_DrvDrawPointRaw(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColorRaw nColRaw)
 {
 #if (GSLC_CLIP_EN)
   // Perform clipping
@@ -565,7 +576,6 @@ bool gslc_DrvDrawPoint(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol)
   if (!gslc_ClipPt(&pDriver->rClipRect,nX,nY)) { return true; }
 #endif
 
-  uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
   gslc_DrvDrawPoint_base(nX, nY, nColRaw);
   return true;
 }
@@ -576,7 +586,67 @@ bool gslc_DrvDrawPoints(gslc_tsGui* pGui,gslc_tsPt* asPt,uint16_t nNumPt,gslc_ts
   return false;
 }
 
+bool gslc_DrvDrawSpans(gslc_tsGui* pGui,gslc_tsSpan* asSpan,uint16_t nSpanCnt,gslc_tsColorRaw nColRaw)
+{
+#if (GSLC_CLIP_EN)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+#else
+  (void)pGui; // Unused
+#endif
+  uint16_t nSpanInd;
+  int16_t  nX0,nY0,nX1,nY1;
+
+  // Keep the bus selected for the whole batch
+  m_disp.startWrite();
+  for (nSpanInd=0;nSpanInd<nSpanCnt;nSpanInd++) {
+    nX0 = asSpan[nSpanInd].nX;
+    nY0 = asSpan[nSpanInd].nY;
+    nX1 = nX0 + (int16_t)asSpan[nSpanInd].nW - 1;
+    nY1 = nY0;
+#if (GSLC_CLIP_EN)
+    if (!gslc_ClipLine(&pDriver->rClipRect,&nX0,&nY0,&nX1,&nY1)) { continue; }
+#endif
+    m_disp.drawFastHLine(nX0,nY0,nX1-nX0+1,nColRaw);
+  }
+  m_disp.endWrite();
+  return true;
+}
+
+bool gslc_DrvCopyRect(gslc_tsGui* pGui,gslc_tsRect rSrc,int16_t nDstX,int16_t nDstY)
+{
+  (void)pGui; // Unused
+#if (GSLC_DISP_READ_EN)
+  // Copy through a small buffer: read back a segment of each row from
+  // the display memory and then write it to the destination. Rows and
+  // segments are visited in the direction of the move so that
+  // overlapping regions are not overwritten before they are read.
+  const int16_t nBufMax = 64;
+  uint16_t  anBuf[nBufMax];
+  int16_t   nRow,nRowY,nSegX,nSegW;
+  for (nRow=0;nRow<(int16_t)rSrc.h;nRow++) {
+    nRowY = (nDstY > rSrc.y)? (int16_t)(rSrc.h-1-nRow) : nRow;
+    for (nSegX=0;nSegX<(int16_t)rSrc.w;nSegX+=nBufMax) {
+      nSegW = ((int16_t)rSrc.w-nSegX < nBufMax)? (int16_t)rSrc.w-nSegX : nBufMax;
+      int16_t nX = (nDstX > rSrc.x)? (int16_t)(rSrc.w-nSegX-nSegW) : nSegX;
+      m_disp.readRect(rSrc.x+nX,rSrc.y+nRowY,nSegW,1,anBuf);
+      m_disp.pushRect(nDstX+nX,nDstY+nRowY,nSegW,1,anBuf);
+    }
+  }
+  return true;
+#else
+  (void)rSrc; // Unused
+  (void)nDstX; // Unused
+  (void)nDstY; // Unused
+  return false;
+#endif
+}
+
 bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
+{
+  return gslc_DrvDrawFillRectRaw(pGui,rRect,gslc_DrvAdaptColorToRaw(nCol));
+}
+
+bool gslc_DrvDrawFillRectRaw(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColorRaw nColRaw)
 {
 #if (GSLC_CLIP_EN)
   // Perform clipping
@@ -584,7 +654,6 @@ bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
   if (!gslc_ClipRect(&pDriver->rClipRect,&rRect)) { return true; }
 #endif
 
-  uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
   m_disp.fillRect(rRect.x,rRect.y,rRect.w,rRect.h,nColRaw);
   return true;
 }
@@ -592,8 +661,8 @@ bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
 bool gslc_DrvDrawFillRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadius,gslc_tsColor nCol)
 {
 #if (DRV_HAS_DRAW_RECT_ROUND_FILL)
-  // TODO: Support GSLC_CLIP_EN
-  // - Would need to determine how to clip the rounded corners
+  // Clipping is performed by the core, which only calls the driver
+  // when the rounded rect lies entirely within the clipping region
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
   m_disp.fillRoundRect(rRect.x,rRect.y,rRect.w,rRect.h,nRadius,nColRaw);
 #endif
@@ -603,7 +672,11 @@ bool gslc_DrvDrawFillRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadiu
 
 bool gslc_DrvDrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
 {
-  uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
+  return gslc_DrvDrawFrameRectRaw(pGui,rRect,gslc_DrvAdaptColorToRaw(nCol));
+}
+
+bool gslc_DrvDrawFrameRectRaw(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColorRaw nColRaw)
+{
 #if (GSLC_CLIP_EN)
   // Perform clipping
   // - TODO: Optimize the following, perhaps with new ClipLineHV()
@@ -644,8 +717,8 @@ bool gslc_DrvDrawFrameRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadi
 #if (DRV_HAS_DRAW_RECT_ROUND_FRAME)
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
 
-  // TODO: Support GSLC_CLIP_EN
-  // - Would need to determine how to clip the rounded corners
+  // Clipping is performed by the core, which only calls the driver
+  // when the rounded rect lies entirely within the clipping region
   m_disp.drawRoundRect(rRect.x,rRect.y,rRect.w,rRect.h,nRadius,nColRaw);
 #endif
   return true;
@@ -654,22 +727,24 @@ bool gslc_DrvDrawFrameRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadi
 
 
 bool gslc_DrvDrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColor nCol)
+{
+  return gslc_DrvDrawLineRaw(pGui,nX0,nY0,nX1,nY1,gslc_DrvAdaptColorToRaw(nCol));
+}
+
+bool gslc_DrvDrawLineRaw(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColorRaw nColRaw)
 {
 #if (GSLC_CLIP_EN)
   gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
   if (!gslc_ClipLine(&pDriver->rClipRect,&nX0,&nY0,&nX1,&nY1)) { return true; }
 #endif
 
-  uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
   gslc_DrvDrawLine_base(nX0,nY0,nX1,nY1,nColRaw);
   return true;
 }
 
 bool gslc_DrvDrawFrameCircle(gslc_tsGui*,int16_t nMidX,int16_t nMidY,uint16_t nRadius,gslc_tsColor nCol)
 {
-#if (GSLC_CLIP_EN)
-  // TODO
-#endif
+  // Clipping is performed by the core (see gslc_ClipBound)
 
 #if (DRV_HAS_DRAW_CIRCLE_FRAME)
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
@@ -680,9 +755,7 @@ bool gslc_DrvDrawFrameCircle(gslc_tsGui*,int16_t nMidX,int16_t nMidY,uint16_t nR
 
 bool gslc_DrvDrawFillCircle(gslc_tsGui*,int16_t nMidX,int16_t nMidY,uint16_t nRadius,gslc_tsColor nCol)
 {
-#if (GSLC_CLIP_EN)
-  // TODO
-#endif
+  // Clipping is performed by the core (see gslc_ClipBound)
 
 #if (DRV_HAS_DRAW_CIRCLE_FILL)
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
@@ -697,9 +770,7 @@ bool gslc_DrvDrawFrameTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
 {
 #if (DRV_HAS_DRAW_TRI_FRAME)
 
-#if (GSLC_CLIP_EN)
-  // TODO
-#endif
+  // Clipping is performed by the core (see gslc_ClipBound)
 
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
   m_disp.drawTriangle(nX0,nY0,nX1,nY1,nX2,nY2,nColRaw);
@@ -712,9 +783,7 @@ bool gslc_DrvDrawFillTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
 {
 #if (DRV_HAS_DRAW_TRI_FILL)
 
-#if (GSLC_CLIP_EN)
-  // TODO
-#endif
+  // Clipping is performed by the core (see gslc_ClipBound)
 
   uint16_t nColRaw = gslc_DrvAdaptColorToRaw(nCol);
   m_disp.fillTriangle(nX0,nY0,nX1,nY1,nX2,nY2,nColRaw);
@@ -1192,6 +1261,12 @@ void* gslc_DrvGetDriverTouch(gslc_tsGui* pGui)
   #endif
 }
 
+uint32_t gslc_DrvGetTimeMs(gslc_tsGui* pGui)
+{
+  (void)pGui; // Unused
+  return millis();
+}
+
 
 bool gslc_DrvInitTouch(gslc_tsGui* pGui, const char* acDev) {
   if (pGui == NULL) {
@@ -109,6 +109,12 @@ extern "C" {
 #if !defined(GSLC_SPIFFS_EN)
   #define GSLC_SPIFFS_EN 0
 #endif // GSLC_SPIFFS_EN
+// - GSLC_DISP_READ_EN: Enable reading back the display memory so that
+//   regions can be copied (eg. when scrolling). Requires the display's
+//   MISO line to be connected and the controller to support readRect().
+#if !defined(GSLC_DISP_READ_EN)
+  #define GSLC_DISP_READ_EN 0
+#endif // GSLC_DISP_READ_EN
 
 
 // =======================================================================
@@ -123,6 +129,7 @@ extern "C" {
 #define DRV_HAS_DRAW_POINT             1 ///< Support gslc_DrvDrawPoint()
 
 #define DRV_HAS_DRAW_POINTS            0 ///< Support gslc_DrvDrawPoints()
+#define DRV_HAS_DRAW_SPANS             1 ///< Support gslc_DrvDrawSpans()
 #define DRV_HAS_DRAW_LINE              1 ///< Support gslc_DrvDrawLine()
 #define DRV_HAS_DRAW_RECT_FRAME        1 ///< Support gslc_DrvDrawFrameRect()
 #define DRV_HAS_DRAW_RECT_FILL         1 ///< Support gslc_DrvDrawFillRect()
@@ -134,6 +141,8 @@ extern "C" {
 #define DRV_HAS_DRAW_TRI_FILL          1 ///< Support gslc_DrvDrawFillTriangle()
 #define DRV_HAS_DRAW_TEXT              1 ///< Support gslc_DrvDrawTxt()
 #define DRV_HAS_DRAW_BMP_MEM           0 ///< Support gslc_DrvDrawBmp24FromMem()
+#define DRV_HAS_PAGE_FLIP_RECT         0 ///< Support gslc_DrvPageFlipRect()
+#define DRV_HAS_COPY_RECT              GSLC_DISP_READ_EN ///< Support gslc_DrvCopyRect()
 
 #define DRV_OVERRIDE_TXT_ALIGN         1 ///< Driver provides text alignment
 
@@ -252,6 +261,17 @@ void* gslc_DrvGetDriverDisp(gslc_tsGui* pGui);
 ///
 void* gslc_DrvGetDriverTouch(gslc_tsGui* pGui);
 
+///
+/// Get the current time from the platform's millisecond clock
+/// - This is used by the core for frame pacing
+/// - The value is free-running and is expected to wrap
+///
+/// \param[in]  pGui:      Pointer to GUI
+///
+/// \return Time in milliseconds
+///
+uint32_t gslc_DrvGetTimeMs(gslc_tsGui* pGui);
+
 // -----------------------------------------------------------------------
 // Image/surface handling Functions
 // -----------------------------------------------------------------------
@@ -436,6 +456,17 @@ void gslc_DrvPageFlipNow(gslc_tsGui* pGui);
 // Graphics Primitives Functions
 // -----------------------------------------------------------------------
 
+///
+/// Convert a color to the native format used by the gslc_DrvDraw*Raw()
+/// primitives
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nCol:        Color RGB value to convert
+///
+/// \return Native color value
+///
+gslc_tsColorRaw gslc_DrvColorToRaw(gslc_tsGui* pGui,gslc_tsColor nCol);
+
 ///
 /// Draw a point
 ///
@@ -448,6 +479,18 @@ void gslc_DrvPageFlipNow(gslc_tsGui* pGui);
 ///
 bool gslc_DrvDrawPoint(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol);
 
+///
+/// Draw a point using a native color
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX:          X coordinate of point
+/// \param[in]  nY:          Y coordinate of point
+/// \param[in]  nColRaw:     Native color value from gslc_DrvColorToRaw()
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawPointRaw(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColorRaw nColRaw);
+
 ///
 /// Draw a point
 ///
@@ -460,6 +503,32 @@ bool gslc_DrvDrawPoint(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol)
 ///
 bool gslc_DrvDrawPoints(gslc_tsGui* pGui,gslc_tsPt* asPt,uint16_t nNumPt,gslc_tsColor nCol);
 
+///
+/// Draw a set of horizontal spans of a single color
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  asSpan:      Array of spans to draw
+/// \param[in]  nSpanCnt:    Number of spans in array
+/// \param[in]  nColRaw:     Native color value from gslc_DrvColorToRaw()
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawSpans(gslc_tsGui* pGui,gslc_tsSpan* asSpan,uint16_t nSpanCnt,gslc_tsColorRaw nColRaw);
+
+///
+/// Copy a rectangular region of the display to another position
+/// - The source and destination regions may overlap
+/// - Only supported by drivers that report DRV_HAS_COPY_RECT
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rSrc:        Rectangular region to copy
+/// \param[in]  nDstX:       X coordinate of destination top-left corner
+/// \param[in]  nDstY:       Y coordinate of destination top-left corner
+///
+/// \return true if the region was copied, false if not supported
+///
+bool gslc_DrvCopyRect(gslc_tsGui* pGui,gslc_tsRect rSrc,int16_t nDstX,int16_t nDstY);
+
 ///
 /// Draw a framed rectangle
 ///
@@ -471,6 +540,17 @@ bool gslc_DrvDrawPoints(gslc_tsGui* pGui,gslc_tsPt* asPt,uint16_t nNumPt,gslc_ts
 ///
 bool gslc_DrvDrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol);
 
+///
+/// Draw a framed rectangle using a native color
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Rectangular region to frame
+/// \param[in]  nColRaw:     Native color value from gslc_DrvColorToRaw()
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawFrameRectRaw(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColorRaw nColRaw);
+
 
 ///
 /// Draw a filled rectangle
@@ -483,6 +563,17 @@ bool gslc_DrvDrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
 ///
 bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol);
 
+///
+/// Draw a filled rectangle using a native color
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Rectangular region to fill
+/// \param[in]  nColRaw:     Native color value from gslc_DrvColorToRaw()
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawFillRectRaw(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColorRaw nColRaw);
+
 
 ///
 /// Draw a framed rounded rectangle
@@ -525,6 +616,20 @@ bool gslc_DrvDrawFillRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadiu
 ///
 bool gslc_DrvDrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColor nCol);
 
+///
+/// Draw a line using a native color
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX0:         Line start (X coordinate)
+/// \param[in]  nY0:         Line start (Y coordinate)
+/// \param[in]  nX1:         Line finish (X coordinate)
+/// \param[in]  nY1:         Line finish (Y coordinate)
+/// \param[in]  nColRaw:     Native color value from gslc_DrvColorToRaw()
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawLineRaw(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColorRaw nColRaw);
+
 
 ///
 /// Draw a framed circle
@@ -109,10 +109,10 @@ gslc_tsElemRef* gslc_ElemXCheckboxCreate(gslc_tsGui* pGui,int16_t nElemId,int16_
   // - NOTE: This is optional (and can be set to NULL).
   //   See the discussion under gslc_ElemXCheckboxTouch()
   sElem.pfuncXTouch       = &gslc_ElemXCheckboxTouch;
-  sElem.colElemFill       = GSLC_COL_BLACK;
-  sElem.colElemFillGlow   = GSLC_COL_BLACK;
-  sElem.colElemFrame      = GSLC_COL_GRAY;
-  sElem.colElemFrameGlow  = GSLC_COL_WHITE;
+  GSLC_ELEM_ATTR(&sElem)->colElemFill       = GSLC_COL_BLACK;
+  GSLC_ELEM_ATTR(&sElem)->colElemFillGlow   = GSLC_COL_BLACK;
+  GSLC_ELEM_ATTR(&sElem)->colElemFrame      = GSLC_COL_GRAY;
+  GSLC_ELEM_ATTR(&sElem)->colElemFrameGlow  = GSLC_COL_WHITE;
   if (nPage != GSLC_PAGE_NONE) {
     pElemRef = gslc_ElemAdd(pGui,nPage,&sElem,GSLC_ELEMREF_DEFAULT);
     return pElemRef;
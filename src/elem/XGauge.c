@@ -116,10 +116,10 @@ gslc_tsElemRef* gslc_ElemXGaugeCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t n
   sElem.pXData            = (void*)(pXData);
   sElem.pfuncXDraw        = &gslc_ElemXGaugeDraw;
   sElem.pfuncXTouch       = NULL;           // No need to track touches
-  sElem.colElemFill       = GSLC_COL_BLACK;
-  sElem.colElemFillGlow   = GSLC_COL_BLACK;
-  sElem.colElemFrame      = GSLC_COL_GRAY;
-  sElem.colElemFrameGlow  = GSLC_COL_GRAY;
+  GSLC_ELEM_ATTR(&sElem)->colElemFill       = GSLC_COL_BLACK;
+  GSLC_ELEM_ATTR(&sElem)->colElemFillGlow   = GSLC_COL_BLACK;
+  GSLC_ELEM_ATTR(&sElem)->colElemFrame      = GSLC_COL_GRAY;
+  GSLC_ELEM_ATTR(&sElem)->colElemFrameGlow  = GSLC_COL_GRAY;
   GSLC_DEBUG_PRINT("NOTE: XGauge has been replaced by XProgress/XRadial/XRamp\n","");
   if (nPage != GSLC_PAGE_NONE) {
     pElemRef = gslc_ElemAdd(pGui,nPage,&sElem,GSLC_ELEMREF_DEFAULT);
@@ -414,7 +414,7 @@ bool gslc_ElemXGaugeDrawProgressBar(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gs
   // Draw a frame around the gauge
   // - Only draw this during full redraw
   if (eRedraw == GSLC_REDRAW_FULL) {
-    gslc_DrawFrameRect(pGui, pElem->rElem, pElem->colElemFrame);
+    gslc_DrawFrameRect(pGui, pElem->rElem, GSLC_ELEM_ATTR(pElem)->colElemFrame);
   }
 
   // To avoid flicker, we only erase the portion of the gauge
@@ -426,23 +426,23 @@ bool gslc_ElemXGaugeDrawProgressBar(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gs
     nEmptyPos = (nGaugeY0 > nElemY1) ? nElemY1 : nGaugeY0;
     rEmpty = (gslc_tsRect){nElemX0,nElemY0,nElemX1-nElemX0+1,nEmptyPos-nElemY0+1};
     rTmp = gslc_ExpandRect(rEmpty,-1,-1);
-    gslc_DrawFillRect(pGui,rTmp,pElem->colElemFill);
+    gslc_DrawFillRect(pGui,rTmp,GSLC_ELEM_ATTR(pElem)->colElemFill);
     // Empty Region #2 (positive)
     nEmptyPos = (nGaugeY1 < nElemY0) ? nElemY0 : nGaugeY1;
     rEmpty = (gslc_tsRect){nElemX0,nEmptyPos,nElemX1-nElemX0+1,nElemY1-nEmptyPos+1};
     rTmp = gslc_ExpandRect(rEmpty,-1,-1);
-    gslc_DrawFillRect(pGui,rTmp,pElem->colElemFill);
+    gslc_DrawFillRect(pGui,rTmp,GSLC_ELEM_ATTR(pElem)->colElemFill);
   } else {
     // Empty Region #1 (negative)
     nEmptyPos = (nGaugeX0 > nElemX1) ? nElemX1 : nGaugeX0;
     rEmpty = (gslc_tsRect){nElemX0,nElemY0,nEmptyPos-nElemX0+1,nElemY1-nElemY0+1};
     rTmp = gslc_ExpandRect(rEmpty,-1,-1);
-    gslc_DrawFillRect(pGui, rTmp, pElem->colElemFill);
+    gslc_DrawFillRect(pGui, rTmp, GSLC_ELEM_ATTR(pElem)->colElemFill);
     // Empty Region #2 (positive)
     nEmptyPos = (nGaugeX1 < nElemX0) ? nElemX0 : nGaugeX1;
     rEmpty = (gslc_tsRect){nEmptyPos,nElemY0,nElemX1-nEmptyPos+1,nElemY1-nElemY0+1};
     rTmp = gslc_ExpandRect(rEmpty,-1,-1);
-    gslc_DrawFillRect(pGui, rTmp, pElem->colElemFill);
+    gslc_DrawFillRect(pGui, rTmp, GSLC_ELEM_ATTR(pElem)->colElemFill);
   }
 
   // Draw the gauge fill region
@@ -454,11 +454,11 @@ bool gslc_ElemXGaugeDrawProgressBar(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gs
   // Draw the midpoint line
   if (bVert) {
     if (nElemY0 + nGaugeMid < nElemY1) {
-      gslc_DrawLine(pGui, nElemX0, nElemY0 + nGaugeMid, nElemX1, nElemY0 + nGaugeMid, pElem->colElemFrame);
+      gslc_DrawLine(pGui, nElemX0, nElemY0 + nGaugeMid, nElemX1, nElemY0 + nGaugeMid, GSLC_ELEM_ATTR(pElem)->colElemFrame);
     }
   } else {
     if (nElemX0 + nGaugeMid < nElemX1) {
-      gslc_DrawLine(pGui, nElemX0 + nGaugeMid, nElemY0, nElemX0 + nGaugeMid, nElemY1, pElem->colElemFrame);
+      gslc_DrawLine(pGui, nElemX0 + nGaugeMid, nElemY0, nElemX0 + nGaugeMid, nElemY1, GSLC_ELEM_ATTR(pElem)->colElemFrame);
     }
   }
 
@@ -559,13 +559,13 @@ bool gslc_ElemXGaugeDrawRadial(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_te
 
   // Clear old
   if (bValLastValid) {
-    gslc_ElemXGaugeDrawRadialHelp(pGui,nElemMidX,nElemMidY,nArrowLen,nArrowSize,n64AngLast,bFill,pElem->colElemFill);
+    gslc_ElemXGaugeDrawRadialHelp(pGui,nElemMidX,nElemMidY,nArrowLen,nArrowSize,n64AngLast,bFill,GSLC_ELEM_ATTR(pElem)->colElemFill);
   }
 
   // Draw frame
   if (eRedraw == GSLC_REDRAW_FULL) {
-    gslc_DrawFillCircle(pGui,nElemMidX,nElemMidY,nElemRad,pElem->colElemFill);  // Erase first
-    gslc_DrawFrameCircle(pGui,nElemMidX,nElemMidY,nElemRad,pElem->colElemFrame);
+    gslc_DrawFillCircle(pGui,nElemMidX,nElemMidY,nElemRad,GSLC_ELEM_ATTR(pElem)->colElemFill);  // Erase first
+    gslc_DrawFrameCircle(pGui,nElemMidX,nElemMidY,nElemRad,GSLC_ELEM_ATTR(pElem)->colElemFrame);
     for (nInd=0;nInd<360;nInd+=nTickAng) {
       gslc_DrawLinePolar(pGui,nElemMidX,nElemMidY,nElemRad-nTickLen,nElemRad,nInd*64,pGauge->colTick);
     }
@@ -683,13 +683,13 @@ bool gslc_ElemXGaugeDrawRamp(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRe
       } else {
         // Inside gap
         // - No draw
-        nCol = pElem->colElemFill;
+        nCol = GSLC_ELEM_ATTR(pElem)->colElemFill;
       }
 
     }
 
     if (bModeErase) {
-      nCol = pElem->colElemFill;
+      nCol = GSLC_ELEM_ATTR(pElem)->colElemFill;
     }
     gslc_DrawLine(pGui,nElemX0+nX,nElemY1-nHeightBot,nElemX0+nX,nElemY1-nHeight,nCol);
 
@@ -95,17 +95,17 @@ gslc_tsElemRef* gslc_ElemXGlowballCreate(gslc_tsGui* pGui, int16_t nElemId, int1
   rElem.y = nMidY - nRadMax;
 
   sElem = gslc_ElemCreate(pGui,nElemId,nPage,GSLC_TYPEX_GLOW,rElem,NULL,0,GSLC_FONT_NONE);
-  sElem.colElemFill       = GSLC_COL_BLACK;
-  sElem.colElemFillGlow   = GSLC_COL_BLACK;
-  sElem.colElemFrame      = GSLC_COL_GRAY;
-  sElem.colElemFrameGlow  = GSLC_COL_GRAY;
-  sElem.colElemText       = GSLC_COL_WHITE;
-  sElem.colElemTextGlow   = GSLC_COL_WHITE;
+  GSLC_ELEM_ATTR(&sElem)->colElemFill       = GSLC_COL_BLACK;
+  GSLC_ELEM_ATTR(&sElem)->colElemFillGlow   = GSLC_COL_BLACK;
+  GSLC_ELEM_ATTR(&sElem)->colElemFrame      = GSLC_COL_GRAY;
+  GSLC_ELEM_ATTR(&sElem)->colElemFrameGlow  = GSLC_COL_GRAY;
+  GSLC_ELEM_ATTR(&sElem)->colElemText       = GSLC_COL_WHITE;
+  GSLC_ELEM_ATTR(&sElem)->colElemTextGlow   = GSLC_COL_WHITE;
   sElem.nFeatures        |= GSLC_ELEM_FEA_FILL_EN;
   sElem.nFeatures        &= ~GSLC_ELEM_FEA_FRAME_EN;
   sElem.nFeatures        |= GSLC_ELEM_FEA_CLICK_EN;
   sElem.nFeatures        |= GSLC_ELEM_FEA_GLOW_EN;
-  sElem.eTxtAlign         = GSLC_ALIGN_MID_LEFT;
+  GSLC_ELEM_ATTR(&sElem)->eTxtAlign         = GSLC_ALIGN_MID_LEFT;
 
   sElem.nGroup            = GSLC_GROUP_ID_NONE;
 
@@ -146,30 +146,8 @@ gslc_tsElemRef* gslc_ElemXGlowballCreate(gslc_tsGui* pGui, int16_t nElemId, int1
 
 void drawXGlowballArc(gslc_tsGui* pGui, gslc_tsXGlowball* pGlowball, int16_t nMidX, int16_t nMidY, int16_t nRad1, int16_t nRad2, gslc_tsColor cArc, uint16_t nAngStart, uint16_t nAngEnd)
 {
-  gslc_tsPt anPts[4];
-  // TODO: Cleanup
-  int16_t nStep64 = 64*360 / pGlowball->nQuality;
-  int16_t nAng64;
-  int16_t nX, nY;
-  int16_t nSegStart, nSegEnd;
-  nSegStart = nAngStart * pGlowball->nQuality / 360;
-  nSegEnd = nAngEnd * pGlowball->nQuality / 360;
-
-  for (int16_t nSegInd = nSegStart; nSegInd < nSegEnd; nSegInd++) {
-    nAng64 = nSegInd * nStep64;
-    nAng64 = nAng64 % (360 * 64);
-
-    gslc_PolarToXY(nRad1, nAng64, &nX, &nY);
-    anPts[0] = (gslc_tsPt) { nMidX + nX, nMidY + nY };
-    gslc_PolarToXY(nRad2, nAng64, &nX, &nY);
-    anPts[1] = (gslc_tsPt) { nMidX + nX, nMidY + nY };
-    gslc_PolarToXY(nRad2, nAng64 + nStep64, &nX, &nY);
-    anPts[2] = (gslc_tsPt) { nMidX + nX, nMidY + nY };
-    gslc_PolarToXY(nRad1, nAng64 + nStep64, &nX, &nY);
-    anPts[3] = (gslc_tsPt) { nMidX + nX, nMidY + nY };
-
-    gslc_DrawFillQuad(pGui, anPts, cArc);
-  }
+  // Draw the arc as a flat sector of the ring
+  gslc_DrawFillSector(pGui, pGlowball->nQuality, nMidX, nMidY, nRad1, nRad2, cArc, nAngStart, nAngEnd);
 }
 
 
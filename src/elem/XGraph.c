@@ -94,6 +94,8 @@ gslc_tsElemRef* gslc_ElemXGraphCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t n
   pXData->nBufMax         = nBufMax;
   pXData->nBufCnt         = 0;
   pXData->nPlotIndStart   = 0;
+  pXData->nPlotIndStartDraw = 0;
+  pXData->nBufCntDraw     = 0;
 
   pXData->colGraph        = colGraph;
   pXData->eStyle          = GSLCX_GRAPH_STYLE_DOT;
@@ -132,10 +134,10 @@ gslc_tsElemRef* gslc_ElemXGraphCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t n
   // Specify the custom drawing callback
   sElem.pfuncXDraw        = &gslc_ElemXGraphDraw;
   sElem.pfuncXTouch       = NULL;
-  sElem.colElemFill       = GSLC_COL_BLACK;
-  sElem.colElemFillGlow   = GSLC_COL_BLACK;
-  sElem.colElemFrame      = GSLC_COL_GRAY;
-  sElem.colElemFrameGlow  = GSLC_COL_WHITE;
+  GSLC_ELEM_ATTR(&sElem)->colElemFill       = GSLC_COL_BLACK;
+  GSLC_ELEM_ATTR(&sElem)->colElemFillGlow   = GSLC_COL_BLACK;
+  GSLC_ELEM_ATTR(&sElem)->colElemFrame      = GSLC_COL_GRAY;
+  GSLC_ELEM_ATTR(&sElem)->colElemFrameGlow  = GSLC_COL_WHITE;
   if (nPage != GSLC_PAGE_NONE) {
     pElemRef = gslc_ElemAdd(pGui,nPage,&sElem,GSLC_ELEMREF_DEFAULT);
     return pElemRef;
@@ -236,7 +238,14 @@ void gslc_ElemXGraphAdd(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,int16_t nVal)
 
   // Set the redraw flag
   // - Only need incremental redraw
-  gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_INC);
+  // - If the entire buffer has been rewritten since the last
+  //   redraw then the changed values can no longer be
+  //   determined, so force a full redraw
+  if (pBox->nBufCnt == pBox->nBufCntDraw) {
+    gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
+  } else {
+    gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_INC);
+  }
 }
 
 void gslc_ElemXGraphReset(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef) {
@@ -291,26 +300,23 @@ bool gslc_ElemXGraphDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw)
   // Draw the frame
   if (eRedraw == GSLC_REDRAW_FULL) {
     if (bFrameEn) {
-      gslc_DrawFrameRect(pGui,pElem->rElem,pElem->colElemFrame);
+      gslc_DrawFrameRect(pGui,pElem->rElem,GSLC_ELEM_ATTR(pElem)->colElemFrame);
     }
   }
 
-  // Clear the background (inset from frame)
-  // TODO: Support incremental redraw in which case we don't
-  //       erase the inner region. Instead we would just erase
-  //       old values and redraw new ones
-  gslc_tsRect rInner = gslc_ExpandRect(pElem->rElem,-1,-1);
-  gslc_DrawFillRect(pGui,rInner,(bGlow)?pElem->colElemFillGlow:pElem->colElemFill);
-
   int16_t           nDataVal;
   uint16_t          nCurX = 0;
   uint16_t          nPixX,nPixY,nPixYBase,nPixYOffset;
   gslc_tsColor      colGraph;
+  gslc_tsColorRaw   nColGraphRaw;
+  gslc_tsPtRun      sDotRun;
 
   uint16_t          nScrollMax;
 
   // Initialize color state
   colGraph  = pBox->colGraph;
+  nColGraphRaw = gslc_ColorToRaw(pGui,colGraph);
+  gslc_DrawPtRunInit(&sDotRun);
 
   // Calculate the current window position based on
   // the current buffer write pointer and scroll
@@ -327,6 +333,55 @@ bool gslc_ElemXGraphDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw)
   uint16_t nPlotInd = 0;
   uint16_t nIndMax = 0;
   nIndMax = (pBox->nBufMax < pBox->nPlotIndMax)? pBox->nBufMax : pBox->nPlotIndMax;
+
+  // Determine the region occupied by the plot
+  // - Each data point maps to a single pixel column
+  gslc_tsRect       rInner = gslc_ExpandRect(pElem->rElem,-1,-1);
+  gslc_tsColor      colFill = (bGlow)?GSLC_ELEM_ATTR(pElem)->colElemFillGlow:GSLC_ELEM_ATTR(pElem)->colElemFill;
+  nPixYBase = pElem->rElem.y - pBox->nMargin + pElem->rElem.h-1;
+  gslc_tsRect       rPlot = (gslc_tsRect){(int16_t)(pElem->rElem.x + pBox->nMargin),
+                        (int16_t)(nPixYBase - pBox->nWndHeight),nIndMax,(uint16_t)(pBox->nWndHeight+1)};
+
+  // For an incremental redraw, scroll the plotted values that remain
+  // in the window and then only draw the exposed columns along with
+  // any values written since the last redraw
+  bool      bRedrawAll = (eRedraw == GSLC_REDRAW_FULL) || (pBox->nBufMax == 0);
+  int16_t   nShift = 0;
+  uint16_t  nBufAdded = 0;
+  int16_t   nPlotExp0 = 0;
+  int16_t   nPlotExp1 = 0;
+  if (!bRedrawAll) {
+    nShift = (int16_t)((pBox->nPlotIndStart + pBox->nBufMax - pBox->nPlotIndStartDraw) % pBox->nBufMax);
+    if (2*nShift > (int16_t)pBox->nBufMax) {
+      nShift -= pBox->nBufMax;
+    }
+    nBufAdded = (pBox->nBufCnt + pBox->nBufMax - pBox->nBufCntDraw) % pBox->nBufMax;
+    if ((nShift == 0) && (nBufAdded == 0)) {
+      // Nothing has changed in the window, so redraw it as requested
+      bRedrawAll = true;
+    } else if ((nShift >= (int16_t)nIndMax) || (-nShift >= (int16_t)nIndMax)) {
+      bRedrawAll = true;
+    } else if (!gslc_IsInRect(rPlot.x,rPlot.y,rInner) ||
+               !gslc_IsInRect(rPlot.x+rPlot.w-1,rPlot.y+rPlot.h-1,rInner)) {
+      bRedrawAll = true;
+    } else if (nShift > 0) {
+      bRedrawAll = !gslc_DrawCopyRect(pGui,(gslc_tsRect){(int16_t)(rPlot.x+nShift),rPlot.y,
+        (uint16_t)(rPlot.w-nShift),rPlot.h},rPlot.x,rPlot.y);
+      nPlotExp0 = nIndMax - nShift;
+      nPlotExp1 = nIndMax;
+    } else if (nShift < 0) {
+      bRedrawAll = !gslc_DrawCopyRect(pGui,(gslc_tsRect){rPlot.x,rPlot.y,
+        (uint16_t)(rPlot.w+nShift),rPlot.h},rPlot.x-nShift,rPlot.y);
+      nPlotExp0 = 0;
+      nPlotExp1 = -nShift;
+    }
+  }
+
+  // Clear the background (inset from frame)
+  if (bRedrawAll) {
+    gslc_DrawFillRect(pGui,rInner,colFill);
+  }
+
   for (nPlotInd=0;nPlotInd<nIndMax;nPlotInd++) {
 
     // Calculate row offset after accounting for buffer wrap
@@ -334,6 +389,18 @@ bool gslc_ElemXGraphDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw)
     uint16_t nBufInd = pBox->nPlotIndStart + nPlotInd;
     nBufInd = nBufInd % pBox->nBufMax;
 
+    if (!bRedrawAll) {
+      // Skip the columns that were scrolled into place unless
+      // their value has been written since the last redraw
+      if (((int16_t)nPlotInd < nPlotExp0) || ((int16_t)nPlotInd >= nPlotExp1)) {
+        if ((nBufInd + pBox->nBufMax - pBox->nBufCntDraw) % pBox->nBufMax >= nBufAdded) {
+          continue;
+        }
+      }
+      // Erase the previous value in the column
+      gslc_DrawFillRect(pGui,(gslc_tsRect){(int16_t)(rPlot.x+nPlotInd),rPlot.y,1,rPlot.h},colFill);
+    }
+
     // NOTE: At the start of buffer fill when we have
     // only written a few values, we will continue to read
     // values out of the buffer so we are dependent upon
@@ -360,7 +427,6 @@ bool gslc_ElemXGraphDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw)
 
     // Determine the drawing coordinates
     nPixX       = pElem->rElem.x + pBox->nMargin + nCurX;
-    nPixYBase   = pElem->rElem.y - pBox->nMargin + pElem->rElem.h-1;
 
     // Calculate Y value
     nPixYOffset = (nDataVal >= 0)? nDataVal : 0;
@@ -372,13 +438,20 @@ bool gslc_ElemXGraphDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw)
 
     // Render the datapoints
     if (pBox->eStyle == GSLCX_GRAPH_STYLE_DOT) {
-      gslc_DrawSetPixel(pGui,nPixX,nPixY,colGraph);
+      // Adjacent dots are merged into lines
+      gslc_DrawPtRunAdd(pGui,&sDotRun,nPixX,nPixY,nColGraphRaw);
     } else if (pBox->eStyle == GSLCX_GRAPH_STYLE_LINE) {
     } else if (pBox->eStyle == GSLCX_GRAPH_STYLE_FILL) {
       gslc_DrawLine(pGui,nPixX,nPixYBase,nPixX,nPixY,colGraph);
     }
 
   }
+  gslc_DrawPtRunFlush(pGui,&sDotRun,nColGraphRaw);
+  gslc_DrawSpanFlush(pGui);
+
+  // Save the window position for the next incremental redraw
+  pBox->nPlotIndStartDraw = pBox->nPlotIndStart;
+  pBox->nBufCntDraw = pBox->nBufCnt;
 
   // Clear the redraw flag
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_NONE);
@@ -82,6 +82,9 @@ typedef struct {
   // Current status
   uint16_t                  nBufCnt;        ///< Number of points in buffer
   uint16_t                  nPlotIndStart;  ///< First row of current window
+  // Redraw
+  uint16_t                  nPlotIndStartDraw; ///< First row of window at last redraw
+  uint16_t                  nBufCntDraw;    ///< Buffer write position at last redraw
 
 } gslc_tsXGraph;
 
@@ -341,11 +341,11 @@ gslc_tsElemRef* gslc_XKeyPadCreateBase(gslc_tsGui* pGui, int16_t nElemId, int16_
   sElem.pfuncXTouch = &gslc_XKeyPadTouch;
  
   // shouldn't be used
-  sElem.colElemFill       = GSLC_COL_BLACK;
-  sElem.colElemFillGlow   = GSLC_COL_BLACK;
-  sElem.colElemFrame      = GSLC_COL_GRAY_DK2;
-  sElem.colElemFrameGlow  = GSLC_COL_WHITE;
-  sElem.colElemText       = GSLC_COL_WHITE;
+  GSLC_ELEM_ATTR(&sElem)->colElemFill       = GSLC_COL_BLACK;
+  GSLC_ELEM_ATTR(&sElem)->colElemFillGlow   = GSLC_COL_BLACK;
+  GSLC_ELEM_ATTR(&sElem)->colElemFrame      = GSLC_COL_GRAY_DK2;
+  GSLC_ELEM_ATTR(&sElem)->colElemFrameGlow  = GSLC_COL_WHITE;
+  GSLC_ELEM_ATTR(&sElem)->colElemText       = GSLC_COL_WHITE;
 
   // Determine offset coordinate of compound element so that we can
   // specify relative positioning during the sub-element Create() operations.
@@ -1231,6 +1231,10 @@ void gslc_XKeyPadDrawVirtualTxt(gslc_tsGui* pGui,gslc_tsRect rElem,gslc_tsXKeyPa
 {
   gslc_tsElem  sElem;
   gslc_tsElem* pVirtualElem = &sElem;
+  #if (GSLC_ELEM_COMPACT)
+  gslc_tsElemAttr sElemAttr;
+  sElem.pAttr = &sElemAttr;
+  #endif
   gslc_tsXKeyPadCfg* pConfig = pKeyPad->pConfig;
 
   // Create the display string from the main buffer
@@ -1284,12 +1288,12 @@ void gslc_XKeyPadDrawVirtualTxt(gslc_tsGui* pGui,gslc_tsRect rElem,gslc_tsXKeyPa
   acDispStr[nDispPos] = '\0';
 
   gslc_ResetElem(pVirtualElem);
-  pVirtualElem->colElemFill       = cColFill;
-  pVirtualElem->colElemFillGlow   = cColFill;
-  pVirtualElem->colElemFrame      = cColFrame;
-  pVirtualElem->colElemFrameGlow  = cColFrame;
-  pVirtualElem->colElemText       = cColTxt;
-  pVirtualElem->colElemTextGlow   = cColTxt;
+  GSLC_ELEM_ATTR(pVirtualElem)->colElemFill       = cColFill;
+  GSLC_ELEM_ATTR(pVirtualElem)->colElemFillGlow   = cColFill;
+  GSLC_ELEM_ATTR(pVirtualElem)->colElemFrame      = cColFrame;
+  GSLC_ELEM_ATTR(pVirtualElem)->colElemFrameGlow  = cColFrame;
+  GSLC_ELEM_ATTR(pVirtualElem)->colElemText       = cColTxt;
+  GSLC_ELEM_ATTR(pVirtualElem)->colElemTextGlow   = cColTxt;
 
   pVirtualElem->nFeatures         = GSLC_ELEM_FEA_NONE;
   pVirtualElem->nFeatures        |= GSLC_ELEM_FEA_FRAME_EN;
@@ -1297,13 +1301,13 @@ void gslc_XKeyPadDrawVirtualTxt(gslc_tsGui* pGui,gslc_tsRect rElem,gslc_tsXKeyPa
   pVirtualElem->nFeatures        |= GSLC_ELEM_FEA_VALID;
 
   pVirtualElem->rElem             = rElem;
-  pVirtualElem->pTxtFont          = gslc_FontGet(pGui,pConfig->nFontId);
+  GSLC_ELEM_ATTR(pVirtualElem)->pTxtFont          = gslc_FontGet(pGui,pConfig->nFontId);
 
-  pVirtualElem->eTxtFlags         = GSLC_TXT_DEFAULT;
-  pVirtualElem->eTxtFlags         = (pVirtualElem->eTxtFlags & ~GSLC_TXT_ALLOC) | GSLC_TXT_ALLOC_EXT;
-  pVirtualElem->eTxtAlign         = GSLC_ALIGN_MID_LEFT;
-  pVirtualElem->nTxtMarginX       = 2;
-  pVirtualElem->nTxtMarginY       = 2;
+  GSLC_ELEM_ATTR(pVirtualElem)->eTxtFlags         = GSLC_TXT_DEFAULT;
+  GSLC_ELEM_ATTR(pVirtualElem)->eTxtFlags         = (GSLC_ELEM_ATTR(pVirtualElem)->eTxtFlags & ~GSLC_TXT_ALLOC) | GSLC_TXT_ALLOC_EXT;
+  GSLC_ELEM_ATTR(pVirtualElem)->eTxtAlign         = GSLC_ALIGN_MID_LEFT;
+  GSLC_ELEM_ATTR(pVirtualElem)->nTxtMarginX       = 2;
+  GSLC_ELEM_ATTR(pVirtualElem)->nTxtMarginY       = 2;
   
   // Render the virtual element
   gslc_tsElemRef sElemRef;
@@ -1327,11 +1331,11 @@ void gslc_XKeyPadDrawVirtualTxt(gslc_tsGui* pGui,gslc_tsRect rElem,gslc_tsXKeyPa
    // pointer, so we can simply update the pointer.
    #if (GSLC_LOCAL_STR)
      // Deep copy
-     gslc_StrCopy(pVirtualElem->pStrBuf,acDispStr,GSLC_LOCAL_STR_LEN);
+     gslc_StrCopy(GSLC_ELEM_ATTR(pVirtualElem)->pStrBuf,acDispStr,GSLC_LOCAL_STR_LEN);
    #else
      // Shallow copy 
-     pVirtualElem->nStrBufMax = 0; // Read-only string buffer
-     pVirtualElem->pStrBuf = acDispStr;
+     GSLC_ELEM_ATTR(pVirtualElem)->nStrBufMax = 0; // Read-only string buffer
+     GSLC_ELEM_ATTR(pVirtualElem)->pStrBuf = acDispStr;
    #endif
    gslc_ElemDrawByRef(pGui,&sElemRef,GSLC_REDRAW_FULL);
 
@@ -1359,8 +1363,8 @@ void gslc_XKeyPadDrawVirtualTxt(gslc_tsGui* pGui,gslc_tsRect rElem,gslc_tsXKeyPa
   
     #if (GSLC_LOCAL_STR)
       // Use the buffer internal to the element
-      char* pStrBuf = pVirtualElem->pStrBuf;
-      // Note that in GSLC_LOCAL_STR mode, pVirtualElem->pStrBuf
+      char* pStrBuf = GSLC_ELEM_ATTR(pVirtualElem)->pStrBuf;
+      // Note that in GSLC_LOCAL_STR mode, GSLC_ELEM_ATTR(pVirtualElem)->pStrBuf
       // is actually an internal character array, so we don't
       // need to update it here.
       //int8_t nStrBufMax = GSLC_LOCAL_STR_LEN;
@@ -1375,7 +1379,7 @@ void gslc_XKeyPadDrawVirtualTxt(gslc_tsGui* pGui,gslc_tsRect rElem,gslc_tsXKeyPa
       // Use the dynamically allocated buffer
       char* pStrBuf = acTempStr;
       // Update the virtual element to use this buffer
-      pVirtualElem->pStrBuf = pStrBuf;
+      GSLC_ELEM_ATTR(pVirtualElem)->pStrBuf = pStrBuf;
       //int8_t nStrBufMax = nDispMax+1;
     #endif
   
@@ -1394,8 +1398,8 @@ void gslc_XKeyPadDrawVirtualTxt(gslc_tsGui* pGui,gslc_tsRect rElem,gslc_tsXKeyPa
     // calculation in ElemDrawByRef, otherwise the margin
     // will be accounted for multiple times. Instead, we
     // clear the margin value but manually offset each render.
-    int16_t nMarginX = pVirtualElem->nTxtMarginX;
-    pVirtualElem->nTxtMarginX = 0;
+    int16_t nMarginX = GSLC_ELEM_ATTR(pVirtualElem)->nTxtMarginX;
+    GSLC_ELEM_ATTR(pVirtualElem)->nTxtMarginX = 0;
   
     // TODO: Determine if/how we should handle:
     // - TxtOffsetX/Y
@@ -1412,11 +1416,11 @@ void gslc_XKeyPadDrawVirtualTxt(gslc_tsGui* pGui,gslc_tsRect rElem,gslc_tsXKeyPa
     nTxtLen = nDispPosCursor;
     gslc_StrCopy(pStrBuf,acDispStr,nTxtLen+1);
   
-    gslc_DrvGetTxtSize(pGui,pVirtualElem->pTxtFont,pStrBuf,pVirtualElem->eTxtFlags,&nTxtOffsetX,&nTxtOffsetY,&nTxtSzW,&nTxtSzH);
+    gslc_DrvGetTxtSize(pGui,GSLC_ELEM_ATTR(pVirtualElem)->pTxtFont,pStrBuf,GSLC_ELEM_ATTR(pVirtualElem)->eTxtFlags,&nTxtOffsetX,&nTxtOffsetY,&nTxtSzW,&nTxtSzH);
     nTxtPosX += nMarginX; // Account for margin once at start
   
     pVirtualElem->rElem = (gslc_tsRect){rElem.x+1+nTxtPosX,rElem.y+1,nTxtSzW,rElem.h-2};
-    pVirtualElem->colElemText = cColTxt;
+    GSLC_ELEM_ATTR(pVirtualElem)->colElemText = cColTxt;
     gslc_ElemDrawByRef(pGui,&sElemRef,GSLC_REDRAW_FULL);
     nTxtPosX += nTxtSzW;
   
@@ -1424,10 +1428,10 @@ void gslc_XKeyPadDrawVirtualTxt(gslc_tsGui* pGui,gslc_tsRect rElem,gslc_tsXKeyPa
     nTxtLen = 1;
     gslc_StrCopy(pStrBuf,acDispStr+nDispPosCursor,nTxtLen+1);
   
-    gslc_DrvGetTxtSize(pGui,pVirtualElem->pTxtFont,pStrBuf,pVirtualElem->eTxtFlags,&nTxtOffsetX,&nTxtOffsetY,&nTxtSzW,&nTxtSzH);
+    gslc_DrvGetTxtSize(pGui,GSLC_ELEM_ATTR(pVirtualElem)->pTxtFont,pStrBuf,GSLC_ELEM_ATTR(pVirtualElem)->eTxtFlags,&nTxtOffsetX,&nTxtOffsetY,&nTxtSzW,&nTxtSzH);
   
     pVirtualElem->rElem = (gslc_tsRect){rElem.x+1+nTxtPosX,rElem.y+1,nTxtSzW,rElem.h-2};
-    pVirtualElem->colElemText = cColFrame;
+    GSLC_ELEM_ATTR(pVirtualElem)->colElemText = cColFrame;
     gslc_ElemDrawByRef(pGui,&sElemRef,GSLC_REDRAW_FULL);
     nTxtPosX += nTxtSzW;
   
@@ -1435,10 +1439,10 @@ void gslc_XKeyPadDrawVirtualTxt(gslc_tsGui* pGui,gslc_tsRect rElem,gslc_tsXKeyPa
     nTxtLen = strlen(acDispStr)-nDispPosCursor;
     gslc_StrCopy(pStrBuf,acDispStr+nDispPosCursor+1,nTxtLen+1);
   
-    gslc_DrvGetTxtSize(pGui,pVirtualElem->pTxtFont,pStrBuf,pVirtualElem->eTxtFlags,&nTxtOffsetX,&nTxtOffsetY,&nTxtSzW,&nTxtSzH);
+    gslc_DrvGetTxtSize(pGui,GSLC_ELEM_ATTR(pVirtualElem)->pTxtFont,pStrBuf,GSLC_ELEM_ATTR(pVirtualElem)->eTxtFlags,&nTxtOffsetX,&nTxtOffsetY,&nTxtSzW,&nTxtSzH);
   
     pVirtualElem->rElem = (gslc_tsRect){rElem.x+1+nTxtPosX,rElem.y+1,nTxtSzW,rElem.h-2};
-    pVirtualElem->colElemText = cColTxt;
+    GSLC_ELEM_ATTR(pVirtualElem)->colElemText = cColTxt;
     gslc_ElemDrawByRef(pGui,&sElemRef,GSLC_REDRAW_FULL);
     nTxtPosX += nTxtSzW;
   
@@ -1454,14 +1458,18 @@ void gslc_XKeyPadDrawVirtualBtn(gslc_tsGui* pGui, gslc_tsRect rElem,
 {
   gslc_tsElem  sElem;
   gslc_tsElem* pVirtualElem = &sElem;
+  #if (GSLC_ELEM_COMPACT)
+  gslc_tsElemAttr sElemAttr;
+  sElem.pAttr = &sElemAttr;
+  #endif
 
   gslc_ResetElem(pVirtualElem);
-  pVirtualElem->colElemFill       = cColFill;
-  pVirtualElem->colElemFillGlow   = cColFillGlow;
-  pVirtualElem->colElemFrame      = cColFrame;
-  pVirtualElem->colElemFrameGlow  = cColFrame;
-  pVirtualElem->colElemText       = cColText;
-  pVirtualElem->colElemTextGlow   = cColText;
+  GSLC_ELEM_ATTR(pVirtualElem)->colElemFill       = cColFill;
+  GSLC_ELEM_ATTR(pVirtualElem)->colElemFillGlow   = cColFillGlow;
+  GSLC_ELEM_ATTR(pVirtualElem)->colElemFrame      = cColFrame;
+  GSLC_ELEM_ATTR(pVirtualElem)->colElemFrameGlow  = cColFrame;
+  GSLC_ELEM_ATTR(pVirtualElem)->colElemText       = cColText;
+  GSLC_ELEM_ATTR(pVirtualElem)->colElemTextGlow   = cColText;
   pVirtualElem->nFeatures         = GSLC_ELEM_FEA_NONE;
   pVirtualElem->nFeatures        |= GSLC_ELEM_FEA_FRAME_EN;
   pVirtualElem->nFeatures        |= GSLC_ELEM_FEA_FILL_EN;
@@ -1472,22 +1480,22 @@ void gslc_XKeyPadDrawVirtualBtn(gslc_tsGui* pGui, gslc_tsRect rElem,
   pVirtualElem->nType             = GSLC_TYPE_BTN;
 
   pVirtualElem->rElem             = rElem;
-  pVirtualElem->pTxtFont          = gslc_FontGet(pGui,nFontId);
+  GSLC_ELEM_ATTR(pVirtualElem)->pTxtFont          = gslc_FontGet(pGui,nFontId);
 
-  pVirtualElem->nStrBufMax        = nStrBufMax;
+  GSLC_ELEM_ATTR(pVirtualElem)->nStrBufMax        = nStrBufMax;
   #if (GSLC_LOCAL_STR)
     // Deep copy
-    gslc_StrCopy(pVirtualElem->pStrBuf,pStrBuf,GSLC_LOCAL_STR_LEN);
+    gslc_StrCopy(GSLC_ELEM_ATTR(pVirtualElem)->pStrBuf,pStrBuf,GSLC_LOCAL_STR_LEN);
   #else
     // Shallow copy 
-    pVirtualElem->pStrBuf         = pStrBuf;
+    GSLC_ELEM_ATTR(pVirtualElem)->pStrBuf         = pStrBuf;
   #endif
 
-  pVirtualElem->eTxtFlags         = GSLC_TXT_DEFAULT;
-  pVirtualElem->eTxtFlags         = (pVirtualElem->eTxtFlags & ~GSLC_TXT_ALLOC) | GSLC_TXT_ALLOC_EXT;
-  pVirtualElem->eTxtAlign         = GSLC_ALIGN_MID_MID;
-  pVirtualElem->nTxtMarginX       = 0;
-  pVirtualElem->nTxtMarginY       = 0;
+  GSLC_ELEM_ATTR(pVirtualElem)->eTxtFlags         = GSLC_TXT_DEFAULT;
+  GSLC_ELEM_ATTR(pVirtualElem)->eTxtFlags         = (GSLC_ELEM_ATTR(pVirtualElem)->eTxtFlags & ~GSLC_TXT_ALLOC) | GSLC_TXT_ALLOC_EXT;
+  GSLC_ELEM_ATTR(pVirtualElem)->eTxtAlign         = GSLC_ALIGN_MID_MID;
+  GSLC_ELEM_ATTR(pVirtualElem)->nTxtMarginX       = 0;
+  GSLC_ELEM_ATTR(pVirtualElem)->nTxtMarginY       = 0;
 
   // For the text buttons, optionally use rounded profile if enabled
   if (bRoundedEn) {
@@ -1519,7 +1527,7 @@ void gslc_ElemXKeyPadInputAsk(gslc_tsGui* pGui, gslc_tsElemRef* pKeyPadRef, int1
   gslc_tsElem* pKeyPad = gslc_GetElemFromRef(pGui,pKeyPadRef);
   gslc_tsXKeyPad* pKeyPadData = (gslc_tsXKeyPad*)(pKeyPad->pXData);
   gslc_tsElem* pTxtElem = gslc_GetElemFromRef(pGui,pTxtRef);
-  pKeyPadData->nBufferMax = (pTxtElem->nStrBufMax >= XKEYPAD_BUF_MAX) ? XKEYPAD_BUF_MAX : pTxtElem->nStrBufMax;
+  pKeyPadData->nBufferMax = (GSLC_ELEM_ATTR(pTxtElem)->nStrBufMax >= XKEYPAD_BUF_MAX) ? XKEYPAD_BUF_MAX : GSLC_ELEM_ATTR(pTxtElem)->nStrBufMax;
 
   // Initialize KeyPad state to defaults
   GSLC_CB_XKEYPAD_RESET  pfuncReset = pKeyPadData->pConfig->pfuncReset;
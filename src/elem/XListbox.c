@@ -500,6 +500,7 @@ gslc_tsElemRef* gslc_ElemXListboxCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t
   pXData->nItemCurSelLast = XLISTBOX_SEL_NONE;
   pXData->nItemSavedSel   = XLISTBOX_SEL_NONE;
   pXData->nItemTop        = 0;
+  pXData->nItemTopLast    = 0;
   pXData->pfuncXSel       = NULL;
   pXData->nCols           = 1;
   pXData->nRows           = XLISTBOX_SIZE_AUTO;     // Auto-calculated from content
@@ -521,14 +522,14 @@ gslc_tsElemRef* gslc_ElemXListboxCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t
   // Specify the custom touch tracking callback
   sElem.pfuncXTouch       = &gslc_ElemXListboxTouch;
 
-  sElem.colElemFill       = GSLC_COL_BLACK;
-  sElem.colElemFillGlow   = GSLC_COL_BLACK;
-  sElem.colElemFrame      = GSLC_COL_GRAY;
-  sElem.colElemFrameGlow  = GSLC_COL_WHITE;
+  GSLC_ELEM_ATTR(&sElem)->colElemFill       = GSLC_COL_BLACK;
+  GSLC_ELEM_ATTR(&sElem)->colElemFillGlow   = GSLC_COL_BLACK;
+  GSLC_ELEM_ATTR(&sElem)->colElemFrame      = GSLC_COL_GRAY;
+  GSLC_ELEM_ATTR(&sElem)->colElemFrameGlow  = GSLC_COL_WHITE;
 
   // Set default text alignment:
   // - Vertical center, left justify
-  sElem.eTxtAlign        = GSLC_ALIGN_MID_LEFT;
+  GSLC_ELEM_ATTR(&sElem)->eTxtAlign        = GSLC_ALIGN_MID_LEFT;
 
   if (nPage != GSLC_PAGE_NONE) {
     pElemRef = gslc_ElemAdd(pGui,nPage,&sElem,GSLC_ELEMREF_DEFAULT);
@@ -586,16 +587,9 @@ bool gslc_ElemXListboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
   pListbox->bGlowLast = bGlow;
   pListbox->bFocusLast = bFocus;
 
-  // If full redraw and gap is enabled:
-  // - Clear background with gap color, as list items
-  //   will be overdrawn in colBg color
-  if (eRedraw == GSLC_REDRAW_FULL) {
-    if (pListbox->nItemGap > 0) {
-      gslc_DrawFillRect(pGui, sState.rInner, pListbox->colGap);
-    }
-  }
-
   // Determine if we need to recalculate the item sizing
+  // - Any items already drawn would then be at the wrong size
+  bool bResized = pListbox->bNeedRecalc;
   if (pListbox->bNeedRecalc) {
     gslc_ElemXListboxRecalcSize(pListbox, sState.rInner);
   }
@@ -622,6 +616,57 @@ bool gslc_ElemXListboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
   nItemBaseY = nY0 + pListbox->nMarginH;
   char acStr[XLISTBOX_MAX_STR+1] = "";
 
+  // If the list has scrolled by whole rows since the last redraw then
+  // move the rows that remain visible and only draw the exposed rows.
+  // Otherwise fall back to redrawing all rows.
+  int16_t nRowExp0 = 0;
+  int16_t nRowExp1 = 0;
+  if ((eRedraw == GSLC_REDRAW_INC) && (pListbox->nItemTop != pListbox->nItemTopLast)) {
+    int16_t     nGap = pListbox->nItemGap;
+    int16_t     nItemOuterH = pListbox->nItemH + nGap;
+    int16_t     nShift = (pListbox->nItemTop - pListbox->nItemTopLast) / nCols;
+    int16_t     nShiftAbs = (nShift > 0)? nShift : -nShift;
+    gslc_tsRect rBand = (gslc_tsRect){nItemBaseX,nItemBaseY,
+                          (uint16_t)(nCols*(pListbox->nItemW + nGap) - nGap),(uint16_t)(nRows*nItemOuterH - nGap)};
+    gslc_tsRect rMove = rBand;
+    gslc_tsRect rExp = rBand;
+    bool        bMoved = false;
+    if ((!bResized) && (nRows > 0) && (nShiftAbs < nRows) &&
+        ((pListbox->nItemTop - pListbox->nItemTopLast) % nCols == 0) &&
+        gslc_IsInRect(rBand.x,rBand.y,sState.rInner) &&
+        gslc_IsInRect(rBand.x+rBand.w-1,rBand.y+rBand.h-1,sState.rInner)) {
+      rMove.h -= nShiftAbs*nItemOuterH;
+      rExp.h = nShiftAbs*nItemOuterH;
+      if (nShift > 0) {
+        rMove.y += nShiftAbs*nItemOuterH;
+        rExp.y += rMove.h;
+        bMoved = gslc_DrawCopyRect(pGui,rMove,rBand.x,rBand.y);
+        nRowExp0 = nRows - nShift;
+        nRowExp1 = nRows;
+      } else {
+        bMoved = gslc_DrawCopyRect(pGui,rMove,rBand.x,rBand.y + rExp.h);
+        nRowExp0 = 0;
+        nRowExp1 = nShiftAbs;
+      }
+    }
+    if (bMoved) {
+      if (nGap > 0) {
+        gslc_DrawFillRect(pGui, rExp, pListbox->colGap);
+      }
+    } else {
+      eRedraw = GSLC_REDRAW_FULL;
+    }
+  }
+
+  // If full redraw and gap is enabled:
+  // - Clear background with gap color, as list items
+  //   will be overdrawn in colBg color
+  if (eRedraw == GSLC_REDRAW_FULL) {
+    if (pListbox->nItemGap > 0) {
+      gslc_DrawFillRect(pGui, sState.rInner, pListbox->colGap);
+    }
+  }
+
 
   // Loop through the items in the list
   int16_t nItemTop = pListbox->nItemTop;
@@ -675,8 +720,8 @@ bool gslc_ElemXListboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
     bItemSel = (nItemInd == nItemCurSel) ? true : false;
 
     // Determine the color based on state
-    colFill = (bItemSel) ? pElem->colElemFillGlow : pElem->colElemFill;
-    colTxt = (bItemSel) ? pElem->colElemTextGlow : pElem->colElemText;
+    colFill = (bItemSel) ? GSLC_ELEM_ATTR(pElem)->colElemFillGlow : GSLC_ELEM_ATTR(pElem)->colElemFill;
+    colTxt = (bItemSel) ? GSLC_ELEM_ATTR(pElem)->colElemTextGlow : GSLC_ELEM_ATTR(pElem)->colElemText;
 
     bool bDoRedraw = false;
     if (eRedraw == GSLC_REDRAW_FULL) {
@@ -688,6 +733,9 @@ bool gslc_ElemXListboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
         bDoRedraw = true;
       } else if (nItemInd == nItemCurSel) {
         bDoRedraw = true;
+      } else if ((nItemIndY >= nRowExp0) && (nItemIndY < nRowExp1)) {
+        // Item in a row exposed by scrolling
+        bDoRedraw = true;
       }
     }
 
@@ -700,14 +748,15 @@ bool gslc_ElemXListboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
       gslc_teTxtFlags eTxtFlags = GSLC_TXT_MEM_RAM | GSLC_TXT_ALLOC_EXT;
 
       // Draw the aligned text string (by default it is GSLC_ALIGN_MID_LEFT)
-      gslc_DrawTxtBase(pGui, acStr, rItemRect, pElem->pTxtFont, eTxtFlags,
-        pElem->eTxtAlign, colTxt, colFill, pElem->nTxtMarginX, pElem->nTxtMarginY);
+      gslc_DrawTxtBase(pGui, acStr, rItemRect, GSLC_ELEM_ATTR(pElem)->pTxtFont, eTxtFlags,
+        GSLC_ELEM_ATTR(pElem)->eTxtAlign, colTxt, colFill, GSLC_ELEM_ATTR(pElem)->nTxtMarginX, GSLC_ELEM_ATTR(pElem)->nTxtMarginY);
     }
 
   }
 
-  // Save the last selected item during redraw
+  // Save the last selected item and scroll position during redraw
   pListbox->nItemCurSelLast = nItemCurSel;
+  pListbox->nItemTopLast = nItemTop;
 
   // Clear the redraw flag
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_NONE);
@@ -1011,8 +1060,9 @@ bool gslc_ElemXListboxSetScrollPos(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef, u
   nScrollPos = (nScrollPos / nCols) * nCols;
   pListbox->nItemTop = nScrollPos;
 
-  // Need to update all rows in display
-  gslc_ElemSetRedraw(pGui, pElemRef, GSLC_REDRAW_FULL);
+  // Only need incremental redraw
+  // - The redraw scrolls the rows that remain in view
+  gslc_ElemSetRedraw(pGui, pElemRef, GSLC_REDRAW_INC);
   return bOk;
 }
 
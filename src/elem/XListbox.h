@@ -90,6 +90,7 @@ typedef struct {
   int16_t         nItemCurSelLast;  ///< Old selected item to redraw (XLISTBOX_SEL_NONE for none)
   int16_t         nItemSavedSel;    ///< Persistent selected item (ie. saved selection)
   int16_t         nItemTop;         ///< Item to show at top of list after scrolling (0 is default)
+  int16_t         nItemTopLast;     ///< Item shown at top of list during last redraw
   bool            bGlowLast;        ///< Last glow state
   bool            bFocusLast;       ///< Last focus state // TODO: Merge with bGlowLast
 
@@ -102,10 +102,10 @@ gslc_tsElemRef* gslc_ElemXProgressCreate(gslc_tsGui* pGui,int16_t nElemId,int16_
   sElem.pXData            = (void*)(pXData);
   sElem.pfuncXDraw        = &gslc_ElemXProgressDraw;
   sElem.pfuncXTouch       = NULL;           // No need to track touches
-  sElem.colElemFill       = GSLC_COL_BLACK;
-  sElem.colElemFillGlow   = GSLC_COL_BLACK;
-  sElem.colElemFrame      = GSLC_COL_GRAY;
-  sElem.colElemFrameGlow  = GSLC_COL_GRAY;
+  GSLC_ELEM_ATTR(&sElem)->colElemFill       = GSLC_COL_BLACK;
+  GSLC_ELEM_ATTR(&sElem)->colElemFillGlow   = GSLC_COL_BLACK;
+  GSLC_ELEM_ATTR(&sElem)->colElemFrame      = GSLC_COL_GRAY;
+  GSLC_ELEM_ATTR(&sElem)->colElemFrameGlow  = GSLC_COL_GRAY;
   if (nPage != GSLC_PAGE_NONE) {
     pElemRef = gslc_ElemAdd(pGui,nPage,&sElem,GSLC_ELEMREF_DEFAULT);
     return pElemRef;
@@ -333,7 +333,7 @@ bool gslc_ElemXProgressDrawHelp(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_t
   // Draw a frame around the gauge
   // - Only draw this during full redraw
   if (eRedraw == GSLC_REDRAW_FULL) {
-    gslc_DrawFrameRect(pGui, pElem->rElem, pElem->colElemFrame);
+    gslc_DrawFrameRect(pGui, pElem->rElem, GSLC_ELEM_ATTR(pElem)->colElemFrame);
   }
 
   // To avoid flicker, we only erase the portion of the gauge
@@ -345,23 +345,23 @@ bool gslc_ElemXProgressDrawHelp(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_t
     nEmptyPos = (nGaugeY0 > nElemY1) ? nElemY1 : nGaugeY0;
     rEmpty = (gslc_tsRect){nElemX0,nElemY0,nElemX1-nElemX0+1,nEmptyPos-nElemY0+1};
     rTmp = gslc_ExpandRect(rEmpty,-1,-1);
-    gslc_DrawFillRect(pGui,rTmp,pElem->colElemFill);
+    gslc_DrawFillRect(pGui,rTmp,GSLC_ELEM_ATTR(pElem)->colElemFill);
     // Empty Region #2 (positive)
     nEmptyPos = (nGaugeY1 < nElemY0) ? nElemY0 : nGaugeY1;
     rEmpty = (gslc_tsRect){nElemX0,nEmptyPos,nElemX1-nElemX0+1,nElemY1-nEmptyPos+1};
     rTmp = gslc_ExpandRect(rEmpty,-1,-1);
-    gslc_DrawFillRect(pGui,rTmp,pElem->colElemFill);
+    gslc_DrawFillRect(pGui,rTmp,GSLC_ELEM_ATTR(pElem)->colElemFill);
   } else {
     // Empty Region #1 (negative)
     nEmptyPos = (nGaugeX0 > nElemX1) ? nElemX1 : nGaugeX0;
     rEmpty = (gslc_tsRect){nElemX0,nElemY0,nEmptyPos-nElemX0+1,nElemY1-nElemY0+1};
     rTmp = gslc_ExpandRect(rEmpty,-1,-1);
-    gslc_DrawFillRect(pGui, rTmp, pElem->colElemFill);
+    gslc_DrawFillRect(pGui, rTmp, GSLC_ELEM_ATTR(pElem)->colElemFill);
     // Empty Region #2 (positive)
     nEmptyPos = (nGaugeX1 < nElemX0) ? nElemX0 : nGaugeX1;
     rEmpty = (gslc_tsRect){nEmptyPos,nElemY0,nElemX1-nEmptyPos+1,nElemY1-nElemY0+1};
     rTmp = gslc_ExpandRect(rEmpty,-1,-1);
-    gslc_DrawFillRect(pGui, rTmp, pElem->colElemFill);
+    gslc_DrawFillRect(pGui, rTmp, GSLC_ELEM_ATTR(pElem)->colElemFill);
   }
 
   // Draw the gauge fill region
@@ -373,11 +373,11 @@ bool gslc_ElemXProgressDrawHelp(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_t
   // Draw the midpoint line
   if (bVert) {
     if (nElemY0 + nGaugeMid < nElemY1) {
-      gslc_DrawLine(pGui, nElemX0, nElemY0 + nGaugeMid, nElemX1, nElemY0 + nGaugeMid, pElem->colElemFrame);
+      gslc_DrawLine(pGui, nElemX0, nElemY0 + nGaugeMid, nElemX1, nElemY0 + nGaugeMid, GSLC_ELEM_ATTR(pElem)->colElemFrame);
     }
   } else {
     if (nElemX0 + nGaugeMid < nElemX1) {
-      gslc_DrawLine(pGui, nElemX0 + nGaugeMid, nElemY0, nElemX0 + nGaugeMid, nElemY1, pElem->colElemFrame);
+      gslc_DrawLine(pGui, nElemX0 + nGaugeMid, nElemY0, nElemX0 + nGaugeMid, nElemY1, GSLC_ELEM_ATTR(pElem)->colElemFrame);
     }
   }
 
@@ -84,14 +84,14 @@ gslc_tsElemRef* gslc_ElemXRingGaugeCreate(gslc_tsGui* pGui, int16_t nElemId, int
   gslc_tsElem     sElem;
   gslc_tsElemRef* pElemRef = NULL;
   sElem = gslc_ElemCreate(pGui,nElemId,nPage,GSLC_TYPEX_RING,rElem,pStrBuf,nStrBufMax,nFontId);
-  sElem.colElemFill       = GSLC_COL_BLACK;
-  sElem.colElemFrame      = GSLC_COL_BLUE;
-  sElem.colElemText       = GSLC_COL_YELLOW;
+  GSLC_ELEM_ATTR(&sElem)->colElemFill       = GSLC_COL_BLACK;
+  GSLC_ELEM_ATTR(&sElem)->colElemFrame      = GSLC_COL_BLUE;
+  GSLC_ELEM_ATTR(&sElem)->colElemText       = GSLC_COL_YELLOW;
   sElem.nFeatures         = GSLC_ELEM_FEA_FILL_EN;
   sElem.nFeatures        &= ~GSLC_ELEM_FEA_FRAME_EN;
   sElem.nFeatures        &= ~GSLC_ELEM_FEA_CLICK_EN;
   sElem.nFeatures        &= ~GSLC_ELEM_FEA_GLOW_EN;
-  sElem.eTxtAlign         = GSLC_ALIGN_MID_MID;
+  GSLC_ELEM_ATTR(&sElem)->eTxtAlign         = GSLC_ALIGN_MID_MID;
 
   sElem.nGroup            = GSLC_GROUP_ID_NONE;
 
@@ -114,6 +114,12 @@ gslc_tsElemRef* gslc_ElemXRingGaugeCreate(gslc_tsGui* pGui, int16_t nElemId, int
   pXData->nValLast = 0;
   pXData->acStrLast[0] = 0;
 
+#if (XRING_CACHE_EN)
+  // Geometry is built on the first draw
+  gslc_RingGeomInit(&(pXData->sGeom), pXData->anGeomRowOuter, pXData->anGeomRowInner, XRING_CACHE_RAD_MAX+1,
+    pXData->asGeomRay, XRING_CACHE_SEG_MAX);
+#endif
+
 
   sElem.pXData            = (void*)(pXData);
   // Specify the custom drawing callback
@@ -175,12 +181,17 @@ bool gslc_ElemXRingGaugeDraw(void* pvGui, void* pvElemRef, gslc_teRedrawType eRe
   int16_t nAngRange = pXRingGauge->nAngRange;
   //int16_t nAngEnd = nAngStart + nAngRange;
   int16_t nQuality = pXRingGauge->nQuality;
+#if (XRING_CACHE_EN)
+  gslc_tsRingGeom* pGeom = &(pXRingGauge->sGeom);
+#else
+  gslc_tsRingGeom* pGeom = NULL;
+#endif
 
   gslc_tsColor colRingActive1 = pXRingGauge->colRing1;
   gslc_tsColor colRingActive2 = pXRingGauge->colRing2;
   gslc_tsColor colRingInactive = pXRingGauge->colRingRemain;
   bool bGradient = pXRingGauge->bGradient;
-  gslc_tsColor colBg = pElem->colElemFill; // Background color used for text clearance
+  gslc_tsColor colBg = GSLC_ELEM_ATTR(pElem)->colElemFill; // Background color used for text clearance
 
   // Calculate the ring center and radius
   int16_t nMidX = nElemX + nElemW / 2;
@@ -238,14 +249,14 @@ bool gslc_ElemXRingGaugeDraw(void* pvGui, void* pvElemRef, gslc_teRedrawType eRe
       #if defined(DBG_REDRAW)
       GSLC_DEBUG2_PRINT("RingDraw:   ActiveG  start=%d end=%d astart=%d arange=%d\n", nDrawStart, nDrawVal,nAngStart,nAngRange);
       #endif
-      gslc_DrawFillGradSector(pGui, nQuality, nMidX, nMidY,
-        nRad1, nRad2, colRingActive1, colRingActive2, nDrawStart, nDrawVal, nAngStart, nAngRange);
+      gslc_DrawFillSectorBase(pGui, nQuality, nMidX, nMidY, nRad1, nRad2, colRingActive1, colRingActive2, true,
+        nAngStart, nAngRange, nDrawStart, nDrawVal, pGeom);
     } else {
       #if defined(DBG_REDRAW)
       GSLC_DEBUG2_PRINT("RingDraw:   Active   start=%d end=%d\n", nDrawStart, nDrawVal);
       #endif
-      gslc_DrawFillSector(pGui, nQuality, nMidX, nMidY,
-        nRad1, nRad2, colRingActive1, nDrawStart, nDrawVal);
+      gslc_DrawFillSectorBase(pGui, nQuality, nMidX, nMidY, nRad1, nRad2, colRingActive1, colRingActive1, false,
+        0, 0, nDrawStart, nDrawVal, pGeom);
     }
   }
 
@@ -254,8 +265,8 @@ bool gslc_ElemXRingGaugeDraw(void* pvGui, void* pvElemRef, gslc_teRedrawType eRe
     GSLC_DEBUG2_PRINT("RingDraw:   Inactive start=%d end=%d\n", nDrawEnd, nDrawVal);
     #endif
     // Since we are erasing, we will reverse the redraw direction (swap Val & End)
-    gslc_DrawFillSector(pGui, nQuality, nMidX, nMidY,
-      nRad1, nRad2, colRingInactive, nDrawEnd, nDrawVal);
+    gslc_DrawFillSectorBase(pGui, nQuality, nMidX, nMidY, nRad1, nRad2, colRingInactive, colRingInactive, false,
+      0, 0, nDrawEnd, nDrawVal, pGeom);
   }
 
   // --------------------------------------------------------------------------
@@ -263,23 +274,23 @@ bool gslc_ElemXRingGaugeDraw(void* pvGui, void* pvElemRef, gslc_teRedrawType eRe
   // --------------------------------------------------------------------------
 
   // Draw text string if defined
-  if (pElem->pStrBuf) {
-    gslc_tsColor  colTxt    = (bGlowNow)? pElem->colElemTextGlow : pElem->colElemText;
-    int8_t        nMarginX  = pElem->nTxtMarginX;
-    int8_t        nMarginY  = pElem->nTxtMarginY;
+  if (GSLC_ELEM_ATTR(pElem)->pStrBuf) {
+    gslc_tsColor  colTxt    = (bGlowNow)? GSLC_ELEM_ATTR(pElem)->colElemTextGlow : GSLC_ELEM_ATTR(pElem)->colElemText;
+    int8_t        nMarginX  = GSLC_ELEM_ATTR(pElem)->nTxtMarginX;
+    int8_t        nMarginY  = GSLC_ELEM_ATTR(pElem)->nTxtMarginY;
 
     // Erase old string content using "background" color
     if (strlen(pXRingGauge->acStrLast) != 0) {
-      gslc_DrawTxtBase(pGui, pXRingGauge->acStrLast, pElem->rElem, pElem->pTxtFont, pElem->eTxtFlags,
-        pElem->eTxtAlign, colBg, GSLC_COL_BLACK, nMarginX, nMarginY);
+      gslc_DrawTxtBase(pGui, pXRingGauge->acStrLast, pElem->rElem, GSLC_ELEM_ATTR(pElem)->pTxtFont, GSLC_ELEM_ATTR(pElem)->eTxtFlags,
+        GSLC_ELEM_ATTR(pElem)->eTxtAlign, colBg, GSLC_COL_BLACK, nMarginX, nMarginY);
     }
 
     // Draw new string content
-    gslc_DrawTxtBase(pGui, pElem->pStrBuf, pElem->rElem, pElem->pTxtFont, pElem->eTxtFlags,
-      pElem->eTxtAlign, colTxt, GSLC_COL_BLACK, nMarginX, nMarginY);
+    gslc_DrawTxtBase(pGui, GSLC_ELEM_ATTR(pElem)->pStrBuf, pElem->rElem, GSLC_ELEM_ATTR(pElem)->pTxtFont, GSLC_ELEM_ATTR(pElem)->eTxtFlags,
+      GSLC_ELEM_ATTR(pElem)->eTxtAlign, colTxt, GSLC_COL_BLACK, nMarginX, nMarginY);
 
     // Save a copy of the new string content so we can support future erase
-    gslc_StrCopy(pXRingGauge->acStrLast, pElem->pStrBuf, XRING_STR_MAX);
+    gslc_StrCopy(pXRingGauge->acStrLast, GSLC_ELEM_ATTR(pElem)->pStrBuf, XRING_STR_MAX);
 
   } // pStrBuf
 
@@ -341,6 +352,9 @@ void gslc_ElemXRingGaugeSetAngleRange(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef
 
   pXRingGauge->nAngStart = nStart;
   pXRingGauge->nAngRange = nRange;
+#if (XRING_CACHE_EN)
+  gslc_RingGeomInvalidate(&(pXRingGauge->sGeom));
+#endif
 
   nRange = (nRange == 0) ? 1 : nRange; // Guard against div/0
 
@@ -356,6 +370,9 @@ void gslc_ElemXRingGaugeSetThickness(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef,
   if (!pXRingGauge) return;
 
   pXRingGauge->nThickness = nThickness;
+#if (XRING_CACHE_EN)
+  gslc_RingGeomInvalidate(&(pXRingGauge->sGeom));
+#endif
 
   // Mark for full redraw
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
@@ -408,6 +425,9 @@ void gslc_ElemXRingGaugeSetQuality(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef, u
 
   nSegments = (nSegments == 0) ? 72 : nSegments; // Guard against div/0 with default
   pXRingGauge->nQuality = nSegments;
+#if (XRING_CACHE_EN)
+  gslc_RingGeomInvalidate(&(pXRingGauge->sGeom));
+#endif
 
   // Mark for full redraw
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
@@ -70,6 +70,26 @@ extern "C" {
 
 #define XRING_STR_MAX 10
 
+// Retained ring geometry
+// - XRING_CACHE_EN: keep the ring extents and segment directions
+//   between redraws so that value updates don't repeat the geometry
+//   calculations. Costs about 800 bytes of RAM per gauge with the
+//   default limits below, so it is disabled by default.
+// - XRING_CACHE_RAD_MAX: largest outer radius that can be retained.
+//   Larger rings are drawn without the cache. Costs 4 bytes per
+//   pixel of radius.
+// - XRING_CACHE_SEG_MAX: number of segment directions retained.
+//   Costs 4 bytes per segment.
+#if !defined(XRING_CACHE_EN)
+  #define XRING_CACHE_EN 0
+#endif
+#if !defined(XRING_CACHE_RAD_MAX)
+  #define XRING_CACHE_RAD_MAX 120
+#endif
+#if !defined(XRING_CACHE_SEG_MAX)
+  #define XRING_CACHE_SEG_MAX 72
+#endif
+
 /// Extended data for XRingGauge element
 typedef struct {
   // Config
@@ -92,6 +112,12 @@ typedef struct {
   int16_t           nVal;           ///< Current position value
   int16_t           nValLast;       ///< Previous position value
   char              acStrLast[XRING_STR_MAX];
+#if (XRING_CACHE_EN)
+  gslc_tsRingGeom   sGeom;          ///< Retained ring geometry
+  int16_t           anGeomRowOuter[XRING_CACHE_RAD_MAX+1]; ///< Storage for ring extents
+  int16_t           anGeomRowInner[XRING_CACHE_RAD_MAX+1]; ///< Storage for hole extents
+  gslc_tsPt         asGeomRay[XRING_CACHE_SEG_MAX];        ///< Storage for segment directions
+#endif
 
   // Callbacks
 
@@ -113,6 +113,9 @@ gslc_tsElemRef* gslc_ElemXSelNumCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t
   //       add new elements.
   // NOTE: We only use RAM for subelement storage
   gslc_CollectReset(&pXData->sCollect,pXData->asElem,nSubElemMax,pXData->asElemRef,nSubElemMax);
+  #if (GSLC_ELEM_COMPACT)
+  gslc_CollectSetElemAttr(&pXData->sCollect,pXData->asElemAttr,nSubElemMax);
+  #endif
 
 
   sElem.pXData            = (void*)(pXData);
@@ -121,10 +124,10 @@ gslc_tsElemRef* gslc_ElemXSelNumCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t
   // Specify the custom touch tracking callback
   sElem.pfuncXTouch       = &gslc_ElemXSelNumTouch;
 
-  sElem.colElemFill       = GSLC_COL_BLACK;
-  sElem.colElemFillGlow   = GSLC_COL_BLACK;
-  sElem.colElemFrame      = GSLC_COL_GRAY;
-  sElem.colElemFrameGlow  = GSLC_COL_WHITE;
+  GSLC_ELEM_ATTR(&sElem)->colElemFill       = GSLC_COL_BLACK;
+  GSLC_ELEM_ATTR(&sElem)->colElemFillGlow   = GSLC_COL_BLACK;
+  GSLC_ELEM_ATTR(&sElem)->colElemFrame      = GSLC_COL_GRAY;
+  GSLC_ELEM_ATTR(&sElem)->colElemFrameGlow  = GSLC_COL_WHITE;
 
 
   // Now create the sub elements
@@ -236,7 +239,7 @@ bool gslc_ElemXSelNumDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw)
   // Draw the compound element fill (background)
   // - Should only need to do this in full redraw
   if (eRedraw == GSLC_REDRAW_FULL) {
-    gslc_DrawFillRect(pGui,pElem->rElem,(bGlow)?pElem->colElemFillGlow:pElem->colElemFill);
+    gslc_DrawFillRect(pGui,pElem->rElem,(bGlow)?GSLC_ELEM_ATTR(pElem)->colElemFillGlow:GSLC_ELEM_ATTR(pElem)->colElemFill);
   }
 
   // Draw the sub-elements
@@ -252,7 +255,7 @@ bool gslc_ElemXSelNumDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw)
   // - We don't need to show any glowing of the compound element
 
   if (eRedraw == GSLC_REDRAW_FULL) {
-    gslc_DrawFrameRect(pGui, pElem->rElem, (bGlow) ? pElem->colElemFrameGlow : pElem->colElemFrame);
+    gslc_DrawFrameRect(pGui, pElem->rElem, (bGlow) ? GSLC_ELEM_ATTR(pElem)->colElemFrameGlow : GSLC_ELEM_ATTR(pElem)->colElemFrame);
   }
 
   // Clear the redraw flag
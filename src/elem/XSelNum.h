@@ -69,6 +69,9 @@ typedef struct {
   gslc_tsCollect      sCollect;       ///< Collection management for sub-elements
   gslc_tsElemRef      asElemRef[4];   ///< Storage for sub-element references
   gslc_tsElem         asElem[4];      ///< Storage for sub-elements
+  #if (GSLC_ELEM_COMPACT)
+  gslc_tsElemAttr     asElemAttr[4];  ///< Storage for sub-element attributes
+  #endif
 
   #if (GSLC_LOCAL_STR == 0)
   // If elements don't provide their own internal string buffer, then
@@ -130,10 +130,10 @@ gslc_tsElemRef* gslc_ElemXSpinnerCreate(gslc_tsGui* pGui, int16_t nElemId, int16
   // Specify the custom touch tracking callback
   sElem.pfuncXTouch = &gslc_ElemXSpinnerTouch;
 
-  sElem.colElemFill = GSLC_COL_BLACK;
-  sElem.colElemFillGlow = GSLC_COL_BLACK;
-  sElem.colElemFrame = GSLC_COL_GRAY;
-  sElem.colElemFrameGlow = GSLC_COL_WHITE;
+  GSLC_ELEM_ATTR(&sElem)->colElemFill = GSLC_COL_BLACK;
+  GSLC_ELEM_ATTR(&sElem)->colElemFillGlow = GSLC_COL_BLACK;
+  GSLC_ELEM_ATTR(&sElem)->colElemFrame = GSLC_COL_GRAY;
+  GSLC_ELEM_ATTR(&sElem)->colElemFrameGlow = GSLC_COL_WHITE;
 
   // create our bounding rectangles for each virtual element
 	
@@ -196,14 +196,18 @@ void gslc_XSpinnerDrawVirtualTxt(gslc_tsGui* pGui,gslc_tsRect rElem,int16_t nFon
 {
   gslc_tsElem  sElem;
   gslc_tsElem* pVirtualElem = &sElem;
+  #if (GSLC_ELEM_COMPACT)
+  gslc_tsElemAttr sElemAttr;
+  sElem.pAttr = &sElemAttr;
+  #endif
 
   gslc_ResetElem(pVirtualElem);
-  pVirtualElem->colElemFill       = cColFill;
-  pVirtualElem->colElemFillGlow   = cColFill;
-  pVirtualElem->colElemFrame      = cColFrame;
-  pVirtualElem->colElemFrameGlow  = cColFrame;
-  pVirtualElem->colElemText       = cColTxt;
-  pVirtualElem->colElemTextGlow   = cColTxt;
+  GSLC_ELEM_ATTR(pVirtualElem)->colElemFill       = cColFill;
+  GSLC_ELEM_ATTR(pVirtualElem)->colElemFillGlow   = cColFill;
+  GSLC_ELEM_ATTR(pVirtualElem)->colElemFrame      = cColFrame;
+  GSLC_ELEM_ATTR(pVirtualElem)->colElemFrameGlow  = cColFrame;
+  GSLC_ELEM_ATTR(pVirtualElem)->colElemText       = cColTxt;
+  GSLC_ELEM_ATTR(pVirtualElem)->colElemTextGlow   = cColTxt;
 
   pVirtualElem->nFeatures         = GSLC_ELEM_FEA_NONE;
   pVirtualElem->nFeatures        |= GSLC_ELEM_FEA_FRAME_EN;
@@ -211,13 +215,13 @@ void gslc_XSpinnerDrawVirtualTxt(gslc_tsGui* pGui,gslc_tsRect rElem,int16_t nFon
   pVirtualElem->nFeatures        |= GSLC_ELEM_FEA_VALID;
 
   pVirtualElem->rElem             = rElem;
-  pVirtualElem->pTxtFont          = gslc_FontGet(pGui,nFontId);
+  GSLC_ELEM_ATTR(pVirtualElem)->pTxtFont          = gslc_FontGet(pGui,nFontId);
 
-  pVirtualElem->eTxtFlags         = GSLC_TXT_DEFAULT;
-  pVirtualElem->eTxtFlags         = (pVirtualElem->eTxtFlags & ~GSLC_TXT_ALLOC) | GSLC_TXT_ALLOC_EXT;
-  pVirtualElem->eTxtAlign         = eTxtAlign;
-  pVirtualElem->nTxtMarginX       = 2;
-  pVirtualElem->nTxtMarginY       = 2;
+  GSLC_ELEM_ATTR(pVirtualElem)->eTxtFlags         = GSLC_TXT_DEFAULT;
+  GSLC_ELEM_ATTR(pVirtualElem)->eTxtFlags         = (GSLC_ELEM_ATTR(pVirtualElem)->eTxtFlags & ~GSLC_TXT_ALLOC) | GSLC_TXT_ALLOC_EXT;
+  GSLC_ELEM_ATTR(pVirtualElem)->eTxtAlign         = eTxtAlign;
+  GSLC_ELEM_ATTR(pVirtualElem)->nTxtMarginX       = 2;
+  GSLC_ELEM_ATTR(pVirtualElem)->nTxtMarginY       = 2;
   
   // Render the virtual element
   gslc_tsElemRef sElemRef;
@@ -230,11 +234,11 @@ void gslc_XSpinnerDrawVirtualTxt(gslc_tsGui* pGui,gslc_tsRect rElem,int16_t nFon
  // pointer, so we can simply update the pointer.
  #if (GSLC_LOCAL_STR)
 	 // Deep copy
-	 gslc_StrCopy(pVirtualElem->pStrBuf,pValStr,GSLC_LOCAL_STR_LEN);
+	 gslc_StrCopy(GSLC_ELEM_ATTR(pVirtualElem)->pStrBuf,pValStr,GSLC_LOCAL_STR_LEN);
  #else
 	 // Shallow copy 
-	 pVirtualElem->nStrBufMax = 0; // Read-only string buffer
-	 pVirtualElem->pStrBuf = pValStr;
+	 GSLC_ELEM_ATTR(pVirtualElem)->nStrBufMax = 0; // Read-only string buffer
+	 GSLC_ELEM_ATTR(pVirtualElem)->pStrBuf = pValStr;
  #endif
    gslc_ElemDrawByRef(pGui,&sElemRef,GSLC_REDRAW_FULL);
 
@@ -247,14 +251,18 @@ void gslc_XSpinnerDrawVirtualBtn(gslc_tsGui* pGui, gslc_tsRect rElem,
 {
   gslc_tsElem  sElem;
   gslc_tsElem* pVirtualElem = &sElem;
+  #if (GSLC_ELEM_COMPACT)
+  gslc_tsElemAttr sElemAttr;
+  sElem.pAttr = &sElemAttr;
+  #endif
 
   gslc_ResetElem(pVirtualElem);
-  pVirtualElem->colElemFill       = cColFill;
-  pVirtualElem->colElemFillGlow   = cColFillGlow;
-  pVirtualElem->colElemFrame      = cColFrame;
-  pVirtualElem->colElemFrameGlow  = cColFrame;
-  pVirtualElem->colElemText       = cColText;
-  pVirtualElem->colElemTextGlow   = cColText;
+  GSLC_ELEM_ATTR(pVirtualElem)->colElemFill       = cColFill;
+  GSLC_ELEM_ATTR(pVirtualElem)->colElemFillGlow   = cColFillGlow;
+  GSLC_ELEM_ATTR(pVirtualElem)->colElemFrame      = cColFrame;
+  GSLC_ELEM_ATTR(pVirtualElem)->colElemFrameGlow  = cColFrame;
+  GSLC_ELEM_ATTR(pVirtualElem)->colElemText       = cColText;
+  GSLC_ELEM_ATTR(pVirtualElem)->colElemTextGlow   = cColText;
   pVirtualElem->nFeatures         = GSLC_ELEM_FEA_NONE;
   pVirtualElem->nFeatures        |= GSLC_ELEM_FEA_FRAME_EN;
   pVirtualElem->nFeatures        |= GSLC_ELEM_FEA_FILL_EN;
@@ -265,22 +273,22 @@ void gslc_XSpinnerDrawVirtualBtn(gslc_tsGui* pGui, gslc_tsRect rElem,
   pVirtualElem->nType             = GSLC_TYPE_BTN;
 
   pVirtualElem->rElem             = rElem;
-  pVirtualElem->pTxtFont          = gslc_FontGet(pGui,nFontId);
+  GSLC_ELEM_ATTR(pVirtualElem)->pTxtFont          = gslc_FontGet(pGui,nFontId);
 
-  pVirtualElem->nStrBufMax        = nStrBufMax;
+  GSLC_ELEM_ATTR(pVirtualElem)->nStrBufMax        = nStrBufMax;
   #if (GSLC_LOCAL_STR)
     // Deep copy
-    gslc_StrCopy(pVirtualElem->pStrBuf,pStrBuf,GSLC_LOCAL_STR_LEN);
+    gslc_StrCopy(GSLC_ELEM_ATTR(pVirtualElem)->pStrBuf,pStrBuf,GSLC_LOCAL_STR_LEN);
   #else
     // Shallow copy 
-    pVirtualElem->pStrBuf         = pStrBuf;
+    GSLC_ELEM_ATTR(pVirtualElem)->pStrBuf         = pStrBuf;
   #endif
 
-  pVirtualElem->eTxtFlags         = GSLC_TXT_DEFAULT;
-  pVirtualElem->eTxtFlags         = (pVirtualElem->eTxtFlags & ~GSLC_TXT_ALLOC) | GSLC_TXT_ALLOC_EXT;
-  pVirtualElem->eTxtAlign         = GSLC_ALIGN_MID_MID;
-  pVirtualElem->nTxtMarginX       = 0;
-  pVirtualElem->nTxtMarginY       = 0;
+  GSLC_ELEM_ATTR(pVirtualElem)->eTxtFlags         = GSLC_TXT_DEFAULT;
+  GSLC_ELEM_ATTR(pVirtualElem)->eTxtFlags         = (GSLC_ELEM_ATTR(pVirtualElem)->eTxtFlags & ~GSLC_TXT_ALLOC) | GSLC_TXT_ALLOC_EXT;
+  GSLC_ELEM_ATTR(pVirtualElem)->eTxtAlign         = GSLC_ALIGN_MID_MID;
+  GSLC_ELEM_ATTR(pVirtualElem)->nTxtMarginX       = 0;
+  GSLC_ELEM_ATTR(pVirtualElem)->nTxtMarginY       = 0;
 
   // For the text buttons, optionally use rounded profile if enabled
   if (bRoundedEn) {
@@ -320,12 +328,12 @@ bool gslc_ElemXSpinnerDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
   // Draw the element fill (background)
   // - Should only need to do this in full redraw
   if (eRedraw == GSLC_REDRAW_FULL) {
-    gslc_DrawFillRect(pGui,pElem->rElem,(bGlow)?pElem->colElemFillGlow:pElem->colElemFill);
+    gslc_DrawFillRect(pGui,pElem->rElem,(bGlow)?GSLC_ELEM_ATTR(pElem)->colElemFillGlow:GSLC_ELEM_ATTR(pElem)->colElemFill);
   }
 
   // Optionally, draw a frame around the element
   if (eRedraw == GSLC_REDRAW_FULL) {
-    gslc_DrawFrameRect(pGui, pElem->rElem, (bGlow) ? pElem->colElemFrameGlow : pElem->colElemFrame);
+    gslc_DrawFrameRect(pGui, pElem->rElem, (bGlow) ? GSLC_ELEM_ATTR(pElem)->colElemFrameGlow : GSLC_ELEM_ATTR(pElem)->colElemFrame);
   }
 
   // draw our virtual elements
@@ -85,17 +85,17 @@ gslc_tsElemRef* gslc_ElemXTemplateCreate(gslc_tsGui* pGui, int16_t nElemId, int1
   gslc_tsElem     sElem;
   gslc_tsElemRef* pElemRef = NULL;
   sElem = gslc_ElemCreate(pGui,nElemId,nPage,GSLC_TYPEX_TEMPLATE,rElem,pStrBuf,nStrBufMax,nFontId);
-  sElem.colElemFill       = GSLC_COL_BLACK;
-  sElem.colElemFillGlow   = GSLC_COL_BLACK;
-  sElem.colElemFrame      = GSLC_COL_GRAY;
-  sElem.colElemFrameGlow  = GSLC_COL_GRAY;
-  sElem.colElemText       = GSLC_COL_WHITE;
-  sElem.colElemTextGlow   = GSLC_COL_WHITE;
+  GSLC_ELEM_ATTR(&sElem)->colElemFill       = GSLC_COL_BLACK;
+  GSLC_ELEM_ATTR(&sElem)->colElemFillGlow   = GSLC_COL_BLACK;
+  GSLC_ELEM_ATTR(&sElem)->colElemFrame      = GSLC_COL_GRAY;
+  GSLC_ELEM_ATTR(&sElem)->colElemFrameGlow  = GSLC_COL_GRAY;
+  GSLC_ELEM_ATTR(&sElem)->colElemText       = GSLC_COL_WHITE;
+  GSLC_ELEM_ATTR(&sElem)->colElemTextGlow   = GSLC_COL_WHITE;
   sElem.nFeatures        |= GSLC_ELEM_FEA_FILL_EN;
   sElem.nFeatures        &= ~GSLC_ELEM_FEA_FRAME_EN;
   sElem.nFeatures        |= GSLC_ELEM_FEA_CLICK_EN;
   sElem.nFeatures        |= GSLC_ELEM_FEA_GLOW_EN;
-  sElem.eTxtAlign         = GSLC_ALIGN_MID_LEFT;
+  GSLC_ELEM_ATTR(&sElem)->eTxtAlign         = GSLC_ALIGN_MID_LEFT;
 
   sElem.nGroup            = GSLC_GROUP_ID_NONE;
 
@@ -185,9 +185,9 @@ bool gslc_ElemXTemplateDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedra
   // - This also changes the fill color if selected and glow state is enabled
   if (pElem->nFeatures & GSLC_ELEM_FEA_FILL_EN) {
     if (bGlowEn && bGlowing) {
-      colBg = pElem->colElemFillGlow;
+      colBg = GSLC_ELEM_ATTR(pElem)->colElemFillGlow;
     } else {
-      colBg = pElem->colElemFill;
+      colBg = GSLC_ELEM_ATTR(pElem)->colElemFill;
     }
     if (pElem->nFeatures & GSLC_ELEM_FEA_ROUND_EN) {
       gslc_DrawFillRoundRect(pGui, rElemInner, pGui->nRoundRadius, colBg);
@@ -206,9 +206,9 @@ bool gslc_ElemXTemplateDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedra
   // Frame the region
   if (pElem->nFeatures & GSLC_ELEM_FEA_FRAME_EN) {
     if (pElem->nFeatures & GSLC_ELEM_FEA_ROUND_EN) {
-      gslc_DrawFrameRoundRect(pGui, pElem->rElem, pGui->nRoundRadius, pElem->colElemFrame);
+      gslc_DrawFrameRoundRect(pGui, pElem->rElem, pGui->nRoundRadius, GSLC_ELEM_ATTR(pElem)->colElemFrame);
     } else {
-      gslc_DrawFrameRect(pGui, pElem->rElem, pElem->colElemFrame);
+      gslc_DrawFrameRect(pGui, pElem->rElem, GSLC_ELEM_ATTR(pElem)->colElemFrame);
     }
   }
 
@@ -217,13 +217,13 @@ bool gslc_ElemXTemplateDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedra
   // --------------------------------------------------------------------------
 
   // Draw text string if defined
-  if (pElem->pStrBuf) {
-    gslc_tsColor  colTxt    = (bGlowNow)? pElem->colElemTextGlow : pElem->colElemText;
-    int8_t        nMarginX  = pElem->nTxtMarginX;
-    int8_t        nMarginY  = pElem->nTxtMarginY;
+  if (GSLC_ELEM_ATTR(pElem)->pStrBuf) {
+    gslc_tsColor  colTxt    = (bGlowNow)? GSLC_ELEM_ATTR(pElem)->colElemTextGlow : GSLC_ELEM_ATTR(pElem)->colElemText;
+    int8_t        nMarginX  = GSLC_ELEM_ATTR(pElem)->nTxtMarginX;
+    int8_t        nMarginY  = GSLC_ELEM_ATTR(pElem)->nTxtMarginY;
 
-    gslc_DrawTxtBase(pGui, pElem->pStrBuf, pElem->rElem, pElem->pTxtFont, pElem->eTxtFlags,
-      pElem->eTxtAlign, colTxt, colBg, nMarginX, nMarginY);
+    gslc_DrawTxtBase(pGui, GSLC_ELEM_ATTR(pElem)->pStrBuf, pElem->rElem, GSLC_ELEM_ATTR(pElem)->pTxtFont, GSLC_ELEM_ATTR(pElem)->eTxtFlags,
+      GSLC_ELEM_ATTR(pElem)->eTxtAlign, colTxt, colBg, nMarginX, nMarginY);
   }
 
   // --------------------------------------------------------------------------
@@ -102,6 +102,7 @@ gslc_tsElemRef* gslc_ElemXTextboxCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t
   pXData->nWndRowStart    = 0;
 
   pXData->nRedrawRow = XTEXTBOX_REDRAW_ALL;
+  pXData->nWndRowStartDraw = 0;
 
   // Clear the buffer
   memset(pBuf,0,nBufRows*nBufCols*sizeof(char));
@@ -118,8 +119,8 @@ gslc_tsElemRef* gslc_ElemXTextboxCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t
   char          acMonoH[3] = "p$";
   char          acMonoW[2] = "W";
 
-  gslc_DrvGetTxtSize(pGui, sElem.pTxtFont, (char*)&acMonoH, sElem.eTxtFlags, &nChOffsetTmp, &nChOffsetY, &nChSzTmp, &nChSzH);
-  gslc_DrvGetTxtSize(pGui, sElem.pTxtFont, (char*)&acMonoW, sElem.eTxtFlags, &nChOffsetX, &nChOffsetTmp, &nChSzW, &nChSzTmp);
+  gslc_DrvGetTxtSize(pGui, GSLC_ELEM_ATTR(&sElem)->pTxtFont, (char*)&acMonoH, GSLC_ELEM_ATTR(&sElem)->eTxtFlags, &nChOffsetTmp, &nChOffsetY, &nChSzTmp, &nChSzH);
+  gslc_DrvGetTxtSize(pGui, GSLC_ELEM_ATTR(&sElem)->pTxtFont, (char*)&acMonoW, GSLC_ELEM_ATTR(&sElem)->eTxtFlags, &nChOffsetX, &nChOffsetTmp, &nChSzW, &nChSzTmp);
 
   pXData->nWndCols = (rElem.w - (2*pXData->nMarginX)) / nChSzW;
   pXData->nWndRows = (rElem.h - (2*pXData->nMarginY)) / nChSzH;
@@ -148,10 +149,10 @@ gslc_tsElemRef* gslc_ElemXTextboxCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t
   // Specify the custom drawing callback
   sElem.pfuncXDraw        = &gslc_ElemXTextboxDraw;
   sElem.pfuncXTouch       = NULL;
-  sElem.colElemFill       = GSLC_COL_BLACK;
-  sElem.colElemFillGlow   = GSLC_COL_BLACK;
-  sElem.colElemFrame      = GSLC_COL_GRAY;
-  sElem.colElemFrameGlow  = GSLC_COL_WHITE;
+  GSLC_ELEM_ATTR(&sElem)->colElemFill       = GSLC_COL_BLACK;
+  GSLC_ELEM_ATTR(&sElem)->colElemFillGlow   = GSLC_COL_BLACK;
+  GSLC_ELEM_ATTR(&sElem)->colElemFrame      = GSLC_COL_GRAY;
+  GSLC_ELEM_ATTR(&sElem)->colElemFrameGlow  = GSLC_COL_WHITE;
   if (nPage != GSLC_PAGE_NONE) {
     pElemRef = gslc_ElemAdd(pGui,nPage,&sElem,GSLC_ELEMREF_DEFAULT);
     return pElemRef;
@@ -214,13 +215,21 @@ void gslc_ElemXTextboxLineWrAdv(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
   // Wrap the pointers around end of buffer
   pBox->nBufPosY      = pBox->nBufPosY % pBox->nBufRows;
 
+  // The new row may still hold an old line that is being recycled,
+  // so include it in the rows pending redraw. If the pending rows
+  // have wrapped around the entire buffer then redraw all rows.
+  if (pBox->nRedrawRow == XTEXTBOX_REDRAW_NONE) {
+    pBox->nRedrawRow = pBox->nBufPosY;
+  } else if (pBox->nRedrawRow == pBox->nBufPosY) {
+    pBox->nRedrawRow = XTEXTBOX_REDRAW_ALL;
+  }
+
   // Did the buffer write pointer start to encroach upon
   // the visible window region? If so, shift the window
+  // - The redraw detects the shift and scrolls the rows
   if (pBox->nBufPosY == pBox->nWndRowStart) {
     // Advance the window (with wrap if needed)
     pBox->nWndRowStart = (pBox->nWndRowStart + 1) % pBox->nBufRows;
-    // Ensure all rows get redrawn
-    pBox->nRedrawRow = XTEXTBOX_REDRAW_ALL;
     gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_INC);
   }
 }
@@ -252,9 +261,8 @@ void gslc_ElemXTextboxScrollSet(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,uint8_
   // Set the redraw flag
   // - Only need incremental redraw
   // - Only redraw if changed actual scroll row
+  // - The redraw detects the shift and scrolls the rows
   if (pBox->nScrollPos != nScrollPosOld) {
-    // Ensure all rows get redrawn
-    pBox->nRedrawRow = XTEXTBOX_REDRAW_ALL;
     gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_INC);
   }
 }
@@ -297,24 +305,13 @@ void gslc_ElemXTextboxBufAdd(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,unsigned
   } else {
 
     // Mark this specific row as needing redraw
+    // - Rows are only written in sequence, so if a redraw is already
+    //   pending then it covers the rows from the first pending row
+    //   up to the current row
     if (pBox->nRedrawRow == XTEXTBOX_REDRAW_NONE) {
       // No redraw was pending, so mark single row pending
       pBox->nRedrawRow = pBox->nBufPosY;
     }
-    else if (pBox->nRedrawRow == XTEXTBOX_REDRAW_ALL) {
-      // All-row redraw was pending, so no change
-    }
-    else {
-      // Single row redraw was pending
-      if (pBox->nRedrawRow != pBox->nBufPosY) {
-        // But the pending row differs from the current row,
-        // so promote redraw to all lines
-        pBox->nRedrawRow = XTEXTBOX_REDRAW_ALL;
-      }
-      else {
-        // Pending row is the same, so no change
-      }
-    }
   } // chNew
 
   // Optionally advance the pointer
@@ -388,7 +385,7 @@ void gslc_ElemXTextboxAdd(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,char* pTxt)
   gslc_tsElem*      pElem = gslc_GetElemFromRef(pGui,pElemRef);
   //gslc_tsXTextbox* pBox = (gslc_tsXTextbox*)(pElem->pXData);
   static bool bWarned = false;  // Warn only once
-  bool bEncUtf8 = ((pElem->eTxtFlags & GSLC_TXT_ENC) == GSLC_TXT_ENC_UTF8);
+  bool bEncUtf8 = ((GSLC_ELEM_ATTR(pElem)->eTxtFlags & GSLC_TXT_ENC) == GSLC_TXT_ENC_UTF8);
   if ((!bWarned) && (bEncUtf8)) {
     // Continue to render the text, but issue warning to the user
     GSLC_DEBUG2_PRINT("WARNING: ElemXTextboxAdd(%s) UTF-8 encoding not supported in GSLC_FEATURE_XTEXTBOX_EMBED=1 mode\n","");
@@ -464,16 +461,74 @@ bool gslc_ElemXTextboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
   // Draw the frame
   if (eRedraw == GSLC_REDRAW_FULL) {
     if (bFrameEn) {
-      gslc_DrawFrameRect(pGui,pElem->rElem,pElem->colElemFrame);
+      gslc_DrawFrameRect(pGui,pElem->rElem,GSLC_ELEM_ATTR(pElem)->colElemFrame);
+    }
+  }
+
+  // Calculate the starting row for the window
+  uint16_t nWndRowStartScr = pBox->nWndRowStart;
+
+  // Only correct for scrollbar position if enabled
+  if (pBox->bScrollEn) {
+    nWndRowStartScr = (pBox->nWndRowStart + pBox->nScrollPos) % pBox->nBufRows;
+  }
+
+  uint8_t nMaxRow = (pBox->nBufRows < pBox->nWndRows)? pBox->nBufRows : pBox->nWndRows;
+
+  gslc_tsRect rInner = gslc_ExpandRect(pElem->rElem, -1, -1);
+  int16_t   nRowsY = pElem->rElem.y + pBox->nMarginY;
+  bool      bRedrawAll = (eRedraw == GSLC_REDRAW_FULL) || (pBox->nRedrawRow == XTEXTBOX_REDRAW_ALL);
+  bool      bClearRows = false;
+  int16_t   nShift = 0;
+  uint16_t  nRedrawLen = 0;
+  int16_t   nRowExp0 = 0;
+  int16_t   nRowExp1 = 0;
+
+  if (!bRedrawAll) {
+    // Determine how many rows the window has moved since the last
+    // redraw (negative if scrolled back) and how many rows beyond
+    // the first pending row have been written
+    nShift = (int16_t)((nWndRowStartScr + pBox->nBufRows - pBox->nWndRowStartDraw) % pBox->nBufRows);
+    if (2*nShift > (int16_t)pBox->nBufRows) {
+      nShift -= pBox->nBufRows;
+    }
+    if (pBox->nRedrawRow >= 0) {
+      nRedrawLen = (pBox->nBufPosY + pBox->nBufRows - pBox->nRedrawRow) % pBox->nBufRows;
+    }
+    if ((nShift != 0) || (nRedrawLen > 0)) {
+      // The rows being drawn may not be blank, so each is cleared first
+      bClearRows = true;
+      if ((nRowsY < rInner.y) || (nRowsY + nMaxRow*pBox->nChSizeY > rInner.y + rInner.h)) {
+        bRedrawAll = true;
+      } else if ((nShift >= nMaxRow) || (-nShift >= nMaxRow)) {
+        bRedrawAll = true;
+      } else if (nShift != 0) {
+        // Move the rows that remain visible and only draw the rows
+        // that have been exposed at the top or bottom
+        int16_t nMoveY = (nShift > 0)? nShift*pBox->nChSizeY : -nShift*pBox->nChSizeY;
+        gslc_tsRect rMove = (gslc_tsRect){rInner.x,nRowsY,rInner.w,(uint16_t)(nMaxRow*pBox->nChSizeY - nMoveY)};
+        if (nShift > 0) {
+          rMove.y += nMoveY;
+          bRedrawAll = !gslc_DrawCopyRect(pGui,rMove,rInner.x,nRowsY);
+          nRowExp0 = nMaxRow - nShift;
+          nRowExp1 = nMaxRow;
+        } else {
+          bRedrawAll = !gslc_DrawCopyRect(pGui,rMove,rInner.x,nRowsY + nMoveY);
+          nRowExp0 = 0;
+          nRowExp1 = -nShift;
+        }
+      }
     }
   }
 
   // Clear the background (inset from frame)
   // - Only do this if we need to redraw all rows
-  if ((eRedraw == GSLC_REDRAW_FULL) || (pBox->nRedrawRow == XTEXTBOX_REDRAW_ALL)) {
-    gslc_tsRect rInner = gslc_ExpandRect(pElem->rElem, -1, -1);
-    colBg = (bGlow) ? pElem->colElemFillGlow : pElem->colElemFill;
+  if (bRedrawAll) {
+    colBg = (bGlow) ? GSLC_ELEM_ATTR(pElem)->colElemFillGlow : GSLC_ELEM_ATTR(pElem)->colElemFill;
     gslc_DrawFillRect(pGui, rInner, colBg);
+    bClearRows = false;
+  } else if (bClearRows) {
+    colBg = (bGlow) ? GSLC_ELEM_ATTR(pElem)->colElemFillGlow : GSLC_ELEM_ATTR(pElem)->colElemFill;
   }
 
   uint16_t          nBufPos = 0;
@@ -486,18 +541,10 @@ bool gslc_ElemXTextboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
 
   // Determine what encoding method is used for text
   // Not used at the moment
-  //bEncUtf8 = ((pElem->eTxtFlags & GSLC_TXT_ENC) == GSLC_TXT_ENC_UTF8);
+  //bEncUtf8 = ((GSLC_ELEM_ATTR(pElem)->eTxtFlags & GSLC_TXT_ENC) == GSLC_TXT_ENC_UTF8);
 
   // Initialize color state
-  colTxt = pElem->colElemText;
-
-  // Calculate the starting row for the window
-  uint16_t nWndRowStartScr = pBox->nWndRowStart;
-
-  // Only correct for scrollbar position if enabled
-  if (pBox->bScrollEn) {
-    nWndRowStartScr = (pBox->nWndRowStart + pBox->nScrollPos) % pBox->nBufRows;
-  }
+  colTxt = GSLC_ELEM_ATTR(pElem)->colElemText;
 
 #if (GSLC_FEATURE_XTEXTBOX_EMBED == 0)
 
@@ -507,9 +554,7 @@ bool gslc_ElemXTextboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
   uint8_t nCurY = 0;
 
   uint8_t nOutRow = 0;
-  uint8_t nMaxRow = 0;
 
-  nMaxRow = (pBox->nBufRows < pBox->nWndRows)? pBox->nBufRows : pBox->nWndRows;
   for (nOutRow=0;nOutRow<nMaxRow;nOutRow++) {
 
     bRedrawLine = true; // Default to drawing the row
@@ -519,15 +564,25 @@ bool gslc_ElemXTextboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
     int16_t nRowCur = nWndRowStartScr + nOutRow;
     nRowCur = nRowCur % pBox->nBufRows;
 
-    // If we are doing incremental redraw and only a single
-    // row has been marked as requiring redraw, then skip
-    // all other rows
-    if (eRedraw == GSLC_REDRAW_INC) {
-      if ((pBox->nRedrawRow >= 0) && (pBox->nRedrawRow != nRowCur)) {
-        // Single-row redraw, but we are not on that row, so skip
+    // If we are doing incremental redraw, then only draw the
+    // rows exposed by scrolling and the rows that have been
+    // written since the last redraw
+    if (!bRedrawAll) {
+      if ((nOutRow >= nRowExp0) && (nOutRow < nRowExp1)) {
+        // Row exposed by scrolling
+      } else if (pBox->nRedrawRow >= 0) {
+        // Skip rows outside of the written range
+        if ((nRowCur + pBox->nBufRows - pBox->nRedrawRow) % pBox->nBufRows > nRedrawLen) {
+          bRedrawLine = false;
+        }
+      } else if (nShift != 0) {
+        // Rows that were moved don't need to be drawn again
         bRedrawLine = false;
       }
     }
+    if ((bRedrawLine) && (bClearRows)) {
+      gslc_DrawFillRect(pGui,(gslc_tsRect){rInner.x,(int16_t)(nRowsY + nCurY * pBox->nChSizeY),rInner.w,pBox->nChSizeY},colBg);
+    }
 
     // NOTE: At the start of buffer fill where we have
     // only written a couple rows, we don't stop reading
@@ -541,10 +596,10 @@ bool gslc_ElemXTextboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
       nTxtPixX = pElem->rElem.x + pBox->nMarginX + 0 * pBox->nChSizeX;
       nTxtPixY = pElem->rElem.y + pBox->nMarginY + nCurY * pBox->nChSizeY;
 #if (DRV_OVERRIDE_TXT_ALIGN)
-      gslc_DrvDrawTxtAlign(pGui,nTxtPixX,nTxtPixY,nTxtPixX,nTxtPixY,GSLC_ALIGN_TOP_LEFT,pElem->pTxtFont,
-            (char*)&(pBox->pBuf[nBufPos]),pElem->eTxtFlags,colTxt,colBg);
+      gslc_DrvDrawTxtAlign(pGui,nTxtPixX,nTxtPixY,nTxtPixX,nTxtPixY,GSLC_ALIGN_TOP_LEFT,GSLC_ELEM_ATTR(pElem)->pTxtFont,
+            (char*)&(pBox->pBuf[nBufPos]),GSLC_ELEM_ATTR(pElem)->eTxtFlags,colTxt,colBg);
 #else
-      gslc_DrvDrawTxt(pGui, nTxtPixX, nTxtPixY, pElem->pTxtFont, (char*)&(pBox->pBuf[nBufPos]), pElem->eTxtFlags, colTxt, colBg);
+      gslc_DrvDrawTxt(pGui, nTxtPixX, nTxtPixY, GSLC_ELEM_ATTR(pElem)->pTxtFont, (char*)&(pBox->pBuf[nBufPos]), GSLC_ELEM_ATTR(pElem)->eTxtFlags, colTxt, colBg);
 #endif
     }
 
@@ -569,10 +624,8 @@ bool gslc_ElemXTextboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
   uint8_t nOutRow = 0;
   uint8_t nOutCol = 0;
   uint8_t nMaxCol = 0;
-  uint8_t nMaxRow = 0;
   bool    bRowDone = false;
   nMaxCol = (pBox->nBufCols < pBox->nWndCols)? pBox->nBufCols : pBox->nWndCols;
-  nMaxRow = (pBox->nBufRows < pBox->nWndRows)? pBox->nBufRows : pBox->nWndRows;
   for (nOutRow=0;nOutRow<nMaxRow;nOutRow++) {
 
     bRedrawLine = true; // Default to drawing the row
@@ -582,15 +635,25 @@ bool gslc_ElemXTextboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
     uint16_t nRowCur = nWndRowStartScr + nOutRow;
     nRowCur = nRowCur % pBox->nBufRows;
 
-    // If we are doing incremental redraw and only a single
-    // row has been marked as requiring redraw, then skip
-    // all other rows
-    if (eRedraw == GSLC_REDRAW_INC) {
-      if ((pBox->nRedrawRow >= 0) && (pBox->nRedrawRow != nRowCur)) {
-        // Single-row redraw, but we are not on that row, so skip
+    // If we are doing incremental redraw, then only draw the
+    // rows exposed by scrolling and the rows that have been
+    // written since the last redraw
+    if (!bRedrawAll) {
+      if ((nOutRow >= nRowExp0) && (nOutRow < nRowExp1)) {
+        // Row exposed by scrolling
+      } else if (pBox->nRedrawRow >= 0) {
+        // Skip rows outside of the written range
+        if ((nRowCur + pBox->nBufRows - pBox->nRedrawRow) % pBox->nBufRows > nRedrawLen) {
+          bRedrawLine = false;
+        }
+      } else if (nShift != 0) {
+        // Rows that were moved don't need to be drawn again
         bRedrawLine = false;
       }
     }
+    if ((bRedrawLine) && (bClearRows)) {
+      gslc_DrawFillRect(pGui,(gslc_tsRect){rInner.x,(int16_t)(nRowsY + nCurY * pBox->nChSizeY),rInner.w,pBox->nChSizeY},colBg);
+    }
 
     bRowDone = false;
     nCurX = 0;
@@ -620,7 +683,7 @@ bool gslc_ElemXTextboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
           nTBoxStateCnt = 0;
         } else if (chNext == GSLC_XTEXTBOX_CODE_COL_RESET) {
           // Reset color
-          colTxt = pElem->colElemText;
+          colTxt = GSLC_ELEM_ATTR(pElem)->colElemText;
         } else {
 
           // Render the character
@@ -633,10 +696,10 @@ bool gslc_ElemXTextboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
           nTxtPixX = pElem->rElem.x + pBox->nMarginX + nCurX * pBox->nChSizeX;
           nTxtPixY = pElem->rElem.y + pBox->nMarginY + nCurY * pBox->nChSizeY;
 #if (DRV_OVERRIDE_TXT_ALIGN)
-          gslc_DrvDrawTxtAlign(pGui,nTxtPixX,nTxtPixY,nTxtPixX,nTxtPixY,GSLC_ALIGN_TOP_LEFT,pElem->pTxtFont,
-            (char*)&acChToDraw,pElem->eTxtFlags,colTxt,colBg);
+          gslc_DrvDrawTxtAlign(pGui,nTxtPixX,nTxtPixY,nTxtPixX,nTxtPixY,GSLC_ALIGN_TOP_LEFT,GSLC_ELEM_ATTR(pElem)->pTxtFont,
+            (char*)&acChToDraw,GSLC_ELEM_ATTR(pElem)->eTxtFlags,colTxt,colBg);
 #else
-          gslc_DrvDrawTxt(pGui,nTxtPixX,nTxtPixY,pElem->pTxtFont,(char*)&acChToDraw,pElem->eTxtFlags,colTxt,colBg);
+          gslc_DrvDrawTxt(pGui,nTxtPixX,nTxtPixY,GSLC_ELEM_ATTR(pElem)->pTxtFont,(char*)&acChToDraw,GSLC_ELEM_ATTR(pElem)->eTxtFlags,colTxt,colBg);
 #endif
           nCurX++;
 
@@ -660,6 +723,7 @@ bool gslc_ElemXTextboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
 
   // Clear the redraw flag
   pBox->nRedrawRow = XTEXTBOX_REDRAW_NONE;
+  pBox->nWndRowStartDraw = nWndRowStartScr;
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_NONE);
    
   // Mark page as needing flip
@@ -86,7 +86,8 @@ typedef struct {
   uint8_t                     nBufPosY;     ///< Buffer Y position
   uint8_t                     nWndRowStart; ///< First row of current window
   // Redraw
-  int16_t                     nRedrawRow;   ///< Specific row to update in redraw (if not -1)
+  int16_t                     nRedrawRow;   ///< First row to update in redraw, up to the write row (if not -1)
+  uint16_t                    nWndRowStartDraw; ///< First row of window (incl scroll) at last redraw
 
 } gslc_tsXTextbox;
 
@@ -109,10 +109,10 @@ gslc_tsElemRef* gslc_ElemXToggleImgbtnCreate(gslc_tsGui* pGui,int16_t nElemId,in
   
   // Specify the custom touch handler
   sElem.pfuncXTouch       = &gslc_ElemXToggleImgbtnTouch;
-  sElem.colElemFill       = GSLC_COL_BLACK;
-  sElem.colElemFillGlow   = GSLC_COL_BLACK;
-  sElem.colElemFrame      = GSLC_COL_BLACK;
-  sElem.colElemFrameGlow  = GSLC_COL_YELLOW;
+  GSLC_ELEM_ATTR(&sElem)->colElemFill       = GSLC_COL_BLACK;
+  GSLC_ELEM_ATTR(&sElem)->colElemFillGlow   = GSLC_COL_BLACK;
+  GSLC_ELEM_ATTR(&sElem)->colElemFrame      = GSLC_COL_BLACK;
+  GSLC_ELEM_ATTR(&sElem)->colElemFrameGlow  = GSLC_COL_YELLOW;
   
   if (nPage != GSLC_PAGE_NONE) {
     pElemRef = gslc_ElemAdd(pGui,nPage,&sElem,GSLC_ELEMREF_DEFAULT);
@@ -283,13 +283,13 @@ bool gslc_ElemXToggleImgbtnDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eR
   int16_t nInnerY = sState.rInner.y;
   if (pToggleImgbtn->bOn) {
     // Glow image might be NULL
-    if (pElem->sImgRefGlow.eImgFlags != GSLC_IMGREF_NONE) {
-      bOk = gslc_DrvDrawImage(pGui,nInnerX,nInnerY,pElem->sImgRefGlow);
+    if (GSLC_ELEM_ATTR(pElem)->sImgRefGlow.eImgFlags != GSLC_IMGREF_NONE) {
+      bOk = gslc_DrvDrawImage(pGui,nInnerX,nInnerY,GSLC_ELEM_ATTR(pElem)->sImgRefGlow);
     } else {
-      bOk = gslc_DrvDrawImage(pGui,nInnerX,nInnerY,pElem->sImgRefNorm);
+      bOk = gslc_DrvDrawImage(pGui,nInnerX,nInnerY,GSLC_ELEM_ATTR(pElem)->sImgRefNorm);
     }
   } else {
-    bOk = gslc_DrvDrawImage(pGui,nInnerX,nInnerY,pElem->sImgRefNorm);
+    bOk = gslc_DrvDrawImage(pGui,nInnerX,nInnerY,GSLC_ELEM_ATTR(pElem)->sImgRefNorm);
   }
 
   if (!bOk) {
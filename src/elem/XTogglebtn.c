@@ -110,10 +110,10 @@ gslc_tsElemRef* gslc_ElemXTogglebtnCreate(gslc_tsGui* pGui,int16_t nElemId,int16
   
   // Specify the custom touch handler
   sElem.pfuncXTouch       = &gslc_ElemXTogglebtnTouch;
-  sElem.colElemFill       = GSLC_COL_BLACK;
-  sElem.colElemFillGlow   = GSLC_COL_BLACK;
-  sElem.colElemFrame      = GSLC_COL_GRAY;
-  sElem.colElemFrameGlow  = GSLC_COL_WHITE;
+  GSLC_ELEM_ATTR(&sElem)->colElemFill       = GSLC_COL_BLACK;
+  GSLC_ELEM_ATTR(&sElem)->colElemFillGlow   = GSLC_COL_BLACK;
+  GSLC_ELEM_ATTR(&sElem)->colElemFrame      = GSLC_COL_GRAY;
+  GSLC_ELEM_ATTR(&sElem)->colElemFrameGlow  = GSLC_COL_WHITE;
   
   if (nPage != GSLC_PAGE_NONE) {
     pElemRef = gslc_ElemAdd(pGui,nPage,&sElem,GSLC_ELEMREF_DEFAULT);
@@ -278,7 +278,7 @@ void gslc_ElemXTogglebtnDrawCircularHelp(gslc_tsGui* pGui,gslc_tsElemRef* pElemR
       // NOTE: On HX8357 and ILI9341 with TFT_eSPI if we do rounded rect frame we get 
       // something that looks like two reversed parenthesis )button( around button 
       gslc_DrawFrameCircle(pGui,nRightX,nRightY,nRadius-1,sState.colFrm);
-      //gslc_DrawFrameRoundRect(pGui,pElem->rElem,pElem->rElem.h,pElem->colElemFrame);
+      //gslc_DrawFrameRoundRect(pGui,pElem->rElem,pElem->rElem.h,GSLC_ELEM_ATTR(pElem)->colElemFrame);
       gslc_DrawFrameRoundRect(pGui,sState.rInner,nRadius,sState.colFrm);
     }
   } else {
@@ -354,7 +354,7 @@ bool gslc_ElemXTogglebtnDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedr
   }
 
   //gslc_tsElem* pElem = gslc_GetElemFromRef(pGui,pElemRef);
-  //gslc_DrawFillRect(pGui,pElem->rElem,pElem->colElemFill);
+  //gslc_DrawFillRect(pGui,pElem->rElem,GSLC_ELEM_ATTR(pElem)->colElemFill);
  
   if (pTogglebtn->bCircular) {
     gslc_ElemXTogglebtnDrawCircularHelp(pGui, pElemRef, pTogglebtn);